@@ -6,7 +6,7 @@
 
 QT       += core gui
 
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets concurrent
 
 CONFIG += c++14
 
@@ -34,8 +34,12 @@ SOURCES += \
     movements.cpp \
     promotiondialog.cpp \
     paths.cpp \
+    sprites.cpp \
+    board.cpp \
+    piecepool.cpp \
     enddialog.cpp \
-    chess_namespaces.cpp
+    chess_namespaces.cpp \
+    material.cpp
 
 HEADERS += \
         mainwindow.h \
@@ -43,8 +47,39 @@ HEADERS += \
     movements.h \
     promotiondialog.h \
     paths.h \
+    sprites.h \
+    board.h \
+    piecepool.h \
     enddialog.h \
-    chess_namespaces.h
+    chess_namespaces.h \
+    material.h
+
+# move generator counters and timers, qmake CONFIG+=statistics
+statistics {
+    DEFINES += QTCHESS_STATISTICS
+
+    SOURCES += statistics.cpp
+}
+
+HEADERS += statistics.h
+
+# timeline of game events in Chrome Trace Event format, qmake CONFIG+=tracing
+tracing {
+    DEFINES += QTCHESS_TRACING
+
+    SOURCES += trace.cpp
+}
+
+HEADERS += trace.h
+
+# heap allocations per generated and made move, qmake CONFIG+=allocations
+allocations {
+    DEFINES += QTCHESS_ALLOCATIONS
+
+    SOURCES += allocations.cpp
+}
+
+HEADERS += allocations.h
 
 FORMS += \
         mainwindow.ui \
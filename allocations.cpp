@@ -0,0 +1,152 @@
+#include "allocations.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <array>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    constexpr const size_t siteCount = static_cast<size_t>(Allocations::Site::Count);
+
+    const std::array<const char*, siteCount> siteNames{{
+        "findValidMoves",
+        "moveExec",
+        "isGameOver"
+    }};
+
+    struct SiteData
+    {
+        quint64 calls{ 0 };
+        quint64 units{ 0 };
+        Allocations::Counters counters;
+    };
+
+    std::array<SiteData, siteCount> sites{};
+
+    // trivial types, no dynamic initialization needed before first allocation
+    thread_local quint64 allocationCount = 0;
+    thread_local quint64 allocatedBytes  = 0;
+
+    void* allocate(std::size_t t_size) {
+        ++allocationCount;
+        allocatedBytes += t_size;
+
+        if(t_size == 0) {
+            t_size = 1;
+        }
+
+        for(;;) {
+            if(void* memory = std::malloc(t_size)) {
+                return memory;
+            }
+
+            std::new_handler handler = std::get_new_handler();
+            if(!handler) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+    void* allocate(std::size_t t_size, const std::nothrow_t&) noexcept {
+        try {
+            return allocate(t_size);
+        }
+        catch(const std::bad_alloc&) {
+            return nullptr;
+        }
+    }
+}
+
+void* operator new(std::size_t t_size) {
+    return allocate(t_size);
+}
+
+void* operator new[](std::size_t t_size) {
+    return allocate(t_size);
+}
+
+void* operator new(std::size_t t_size, const std::nothrow_t& t_tag) noexcept {
+    return allocate(t_size, t_tag);
+}
+
+void* operator new[](std::size_t t_size, const std::nothrow_t& t_tag) noexcept {
+    return allocate(t_size, t_tag);
+}
+
+void operator delete(void* t_memory) noexcept {
+    std::free(t_memory);
+}
+
+void operator delete[](void* t_memory) noexcept {
+    std::free(t_memory);
+}
+
+void operator delete(void* t_memory, std::size_t) noexcept {
+    std::free(t_memory);
+}
+
+void operator delete[](void* t_memory, std::size_t) noexcept {
+    std::free(t_memory);
+}
+
+void operator delete(void* t_memory, const std::nothrow_t&) noexcept {
+    std::free(t_memory);
+}
+
+void operator delete[](void* t_memory, const std::nothrow_t&) noexcept {
+    std::free(t_memory);
+}
+
+Allocations::Counters Allocations::current() noexcept {
+    return { allocationCount, allocatedBytes };
+}
+
+void Allocations::addUnits(Site t_site, quint64 t_units) noexcept {
+    sites[static_cast<size_t>(t_site)].units += t_units;
+}
+
+void Allocations::reset() noexcept {
+    sites.fill({});
+}
+
+QByteArray Allocations::toJson() {
+    QJsonObject root;
+    for(size_t i = 0; i < siteCount; ++i) {
+        const auto& site = sites[i];
+
+        // work done per call, unless site reports its own units
+        const quint64 units{ site.units == 0 ? site.calls : site.units };
+
+        QJsonObject siteObject;
+        siteObject.insert("calls",       static_cast<qint64>(site.calls));
+        siteObject.insert("units",       static_cast<qint64>(units));
+        siteObject.insert("allocations", static_cast<qint64>(site.counters.allocations));
+        siteObject.insert("bytes",       static_cast<qint64>(site.counters.bytes));
+        siteObject.insert("allocationsPerUnit", units == 0 ?
+                              0 : static_cast<double>(site.counters.allocations) / units);
+        siteObject.insert("bytesPerUnit",       units == 0 ?
+                              0 : static_cast<double>(site.counters.bytes) / units);
+
+        root.insert(siteNames[i], siteObject);
+    }
+
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+Allocations::Scope::Scope(Site t_site) noexcept
+    : m_site(t_site), m_start(current())
+{
+}
+
+Allocations::Scope::~Scope()
+{
+    const Counters end{ current() };
+    auto& site = sites[static_cast<size_t>(m_site)];
+
+    ++site.calls;
+    site.counters.allocations += end.allocations - m_start.allocations;
+    site.counters.bytes       += end.bytes - m_start.bytes;
+}
@@ -0,0 +1,66 @@
+#ifndef ALLOCATIONS_H
+#define ALLOCATIONS_H
+
+#include <QByteArray>
+#include <QtGlobal>
+
+// Heap allocations made through global operator new, enabled with
+// qmake CONFIG+=allocations. ALLOC_SCOPE attributes allocations of its
+// scope to a site, so hot paths can be kept allocation free. When
+// disabled, ALLOC_* macros expand to nothing and operator new is not
+// replaced (value passed to ALLOC_UNITS is still evaluated).
+namespace Allocations {
+    struct Counters
+    {
+        quint64 allocations{ 0 };
+        quint64 bytes{ 0 };
+    };
+
+    enum class Site : int {
+        FindValidMoves = 0,
+        MoveExec,
+        IsGameOver,
+        Count
+    };
+
+    // allocations made by the calling thread so far
+    Counters current() noexcept;
+
+    // work done in site, e.g. number of generated moves
+    void addUnits(Site t_site, quint64 t_units) noexcept;
+    void reset() noexcept;
+
+    // calls, units, allocations and bytes of every site as JSON object
+    QByteArray toJson();
+
+    // adds allocations made in its scope to given site,
+    // sites are meant to be used from the GUI thread only
+    class Scope
+    {
+    public:
+        explicit Scope(Site t_site) noexcept;
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Site m_site;
+        Counters m_start;
+    };
+}
+
+#define ALLOC_CONCAT_IMPL(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_IMPL(a, b)
+
+#ifdef QTCHESS_ALLOCATIONS
+#   define ALLOC_SCOPE(site) \
+        Allocations::Scope ALLOC_CONCAT(allocScope, __LINE__){ Allocations::Site::site }
+#   define ALLOC_UNITS(site, value) \
+        Allocations::addUnits(Allocations::Site::site, (value))
+#else
+#   define ALLOC_SCOPE(site)        static_cast<void>(0)
+#   define ALLOC_UNITS(site, value) static_cast<void>(value)
+#endif
+
+#endif // ALLOCATIONS_H
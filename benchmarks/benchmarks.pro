@@ -0,0 +1,77 @@
+#-------------------------------------------------
+#
+# Benchmarks of the QtChess move generator
+#
+# qmake benchmarks.pro && make && ./qtchess_benchmarks
+# compare two runs with compare/benchcompare
+#
+#-------------------------------------------------
+
+QT       += core gui widgets concurrent
+
+CONFIG += c++14 console
+CONFIG -= app_bundle
+
+TARGET = qtchess_benchmarks
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+DEFINES += QTCHESS_BENCHMARK
+
+# recorded in results, so runs can be matched with commits
+REVISION = $$system(git -C $$PWD rev-parse --short HEAD)
+isEmpty(REVISION): REVISION = unknown
+DEFINES += QTCHESS_REVISION=\\\"$$REVISION\\\"
+
+QMAKE_CXXFLAGS += -Wall
+QMAKE_CXXFLAGS += -Wextra
+
+INCLUDEPATH += ..
+
+SOURCES += \
+    main.cpp \
+    boardsetup.cpp \
+    compare/benchstatistics.cpp \
+    ../chesspiece.cpp \
+    ../movements.cpp \
+    ../promotiondialog.cpp \
+    ../paths.cpp \
+    ../sprites.cpp \
+    ../board.cpp \
+    ../piecepool.cpp \
+    ../enddialog.cpp \
+    ../chess_namespaces.cpp \
+    ../material.cpp
+
+HEADERS += \
+    boardsetup.h \
+    compare/benchstatistics.h \
+    ../chesspiece.h \
+    ../movements.h \
+    ../promotiondialog.h \
+    ../paths.h \
+    ../sprites.h \
+    ../board.h \
+    ../piecepool.h \
+    ../enddialog.h \
+    ../chess_namespaces.h \
+    ../material.h \
+    ../statistics.h \
+    ../trace.h \
+    ../allocations.h
+
+# allocations and bytes per op, qmake CONFIG+=allocations; counting
+# operator new slows down benchmarks which allocate, so timings of such
+# build are not comparable with a default one
+allocations {
+    DEFINES += QTCHESS_ALLOCATIONS
+
+    SOURCES += ../allocations.cpp
+}
+
+FORMS += \
+    ../promotiondialog.ui \
+    ../enddialog.ui
+
+RESOURCES += \
+    ../resources.qrc
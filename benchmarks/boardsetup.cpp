@@ -0,0 +1,154 @@
+#include "boardsetup.h"
+
+#include "../board.h"
+#include "../chess_namespaces.h"
+#include "../chesspiece.h"
+#include "../piecepool.h"
+
+#include <QStringList>
+
+namespace {
+    bool toPieceType(QChar t_char, PieceType& t_type) noexcept {
+        switch (t_char.toLower().toLatin1()) {
+            case 'p': t_type = PieceType::Pawn;   return true;
+            case 'n': t_type = PieceType::Knight; return true;
+            case 'b': t_type = PieceType::Bishop; return true;
+            case 'r': t_type = PieceType::Rook;   return true;
+            case 'q': t_type = PieceType::Queen;  return true;
+            case 'k': t_type = PieceType::King;   return true;
+        }
+        return false;
+    }
+
+    // FEN file and rank to top-left corner of field, black starts at the top
+    QPointF toPoint(int t_file, int t_rank) noexcept {
+        return { t_file * BoardSizes::FieldWidth,
+                 (BoardSizes::MaxRowCount - t_rank) * BoardSizes::FieldHeight };
+    }
+
+    ChessPiece* pieceAt(const QPointF& t_pos) noexcept {
+        for(auto* pieces : { &GameStatus::White::pieces, &GameStatus::Black::pieces }) {
+            for(ChessPiece* piece : *pieces) {
+                if(piece->m_lastPos == t_pos) {
+                    return piece;
+                }
+            }
+        }
+        return nullptr;
+    }
+}
+
+BoardSetup::BoardSetup(const QString& t_fen)
+{
+    GameStatus::board = new Board;
+    m_scene.addItem(GameStatus::board);
+
+    const QStringList fields{ t_fen.split(' ') };
+
+    const QString placement{ fields.value(0) };
+    const QString castling { fields.value(2, "-") };
+
+    m_sideToMove = fields.value(1, "w") == "b" ? Player::Black : Player::White;
+
+    int rank = BoardSizes::MaxRowCount;
+    int file = 0;
+    for(const QChar c : placement) {
+        if(c == '/') {
+            --rank;
+            file = 0;
+            continue;
+        }
+        if(c.isDigit()) {
+            file += c.digitValue();
+            continue;
+        }
+
+        PieceType type;
+        if(!toPieceType(c, type)) {
+            continue;
+        }
+
+        const Player player{ c.isUpper() ? Player::White : Player::Black };
+
+        // pawns on their starting rank, king and rooks allowed to castle
+        const bool firstMove = [&] {
+            const QChar kingSide { player == Player::White ? 'K' : 'k' };
+            const QChar queenSide{ player == Player::White ? 'Q' : 'q' };
+            const int   homeRank { player == Player::White ? 1 : BoardSizes::MaxRowCount };
+
+            switch (type) {
+                case PieceType::Pawn:
+                    return rank == (player == Player::White ? 2 : 7);
+                case PieceType::King:
+                    return rank == homeRank && file == 4 &&
+                           (castling.contains(kingSide) || castling.contains(queenSide));
+                case PieceType::Rook:
+                    // castling rights do not apply to a rook that reached the corner
+                    if(rank != homeRank) {
+                        return false;
+                    }
+                    if(file == 0) {
+                        return castling.contains(queenSide);
+                    }
+                    if(file == BoardSizes::MaxColCount - 1) {
+                        return castling.contains(kingSide);
+                    }
+                    return false;
+                default:
+                    return false;
+            }
+        }();
+
+        const QPointF point{ toPoint(file, rank) };
+        ChessPiece* piece = ChessPiece::Create(type, point, player, &m_scene, firstMove);
+
+        auto& pieces = player == Player::White ? GameStatus::White::pieces :
+                                                 GameStatus::Black::pieces;
+        if(type == PieceType::King) {
+            (player == Player::White ? GameStatus::White::king :
+                                       GameStatus::Black::king) = static_cast<King*>(piece);
+        }
+        pieces.push_back(piece);
+        GameStatus::material.add(type, player, point);
+
+        m_scene.addItem(piece);
+        ++file;
+    }
+
+    // pawn which has just moved two fields can be taken en passant
+    const QString enPassant{ fields.value(3, "-") };
+    if(enPassant.size() == 2) {
+        const int epFile{ enPassant.at(0).toLatin1() - 'a' };
+        const int epRank{ enPassant.at(1).digitValue() };
+        const int pawnRank{ epRank == 3 ? 4 : 5 };
+
+        auto* pawn = dynamic_cast<Pawn*>(pieceAt(toPoint(epFile, pawnRank)));
+        if(pawn) {
+            pawn->m_enPassant = true;
+        }
+    }
+
+    GameStatus::uselessMoves  = fields.value(4, "0").toInt();
+    GameStatus::currentPlayer = m_sideToMove;
+}
+
+BoardSetup::~BoardSetup()
+{
+    // scene deletes pieces and board
+    GameStatus::White::pieces.clear();
+    GameStatus::Black::pieces.clear();
+
+    GameStatus::White::king = nullptr;
+    GameStatus::Black::king = nullptr;
+    GameStatus::board       = nullptr;
+
+    GameStatus::currentPlayer = Player::White;
+    GameStatus::uselessMoves  = 0;
+
+    PiecePool::clear();
+    GameStatus::material.clear();
+}
+
+Player BoardSetup::sideToMove() const noexcept {
+    return m_sideToMove;
+}
@@ -0,0 +1,28 @@
+#ifndef BOARDSETUP_H
+#define BOARDSETUP_H
+
+#include <QGraphicsScene>
+#include <QString>
+
+enum class Player : char;
+
+// Places position given in FEN on its own scene together with the board
+// and fills GameStatus, the same way MainWindow does for a new game.
+// Only one BoardSetup may exist at a time, as GameStatus is global.
+class BoardSetup
+{
+public:
+    explicit BoardSetup(const QString& t_fen);
+    ~BoardSetup();
+
+    BoardSetup(const BoardSetup&) = delete;
+    BoardSetup& operator=(const BoardSetup&) = delete;
+
+    Player sideToMove() const noexcept;
+
+private:
+    QGraphicsScene m_scene;
+    Player m_sideToMove;
+};
+
+#endif // BOARDSETUP_H
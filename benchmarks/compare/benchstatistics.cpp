@@ -0,0 +1,90 @@
+#include "benchstatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+double BenchStatistics::median(std::vector<double> t_samples) {
+    if(t_samples.empty()) {
+        return 0.0;
+    }
+
+    const size_t half{ t_samples.size() / 2 };
+    std::nth_element(std::begin(t_samples), std::begin(t_samples) + half, std::end(t_samples));
+    const double upper{ t_samples[half] };
+
+    if(t_samples.size() % 2 == 1) {
+        return upper;
+    }
+
+    const double lower{ *std::max_element(std::begin(t_samples), std::begin(t_samples) + half) };
+    return (lower + upper) / 2.0;
+}
+
+double BenchStatistics::mad(const std::vector<double>& t_samples) {
+    const double center{ median(t_samples) };
+
+    std::vector<double> deviations;
+    deviations.reserve(t_samples.size());
+    for(double sample : t_samples) {
+        deviations.push_back(std::abs(sample - center));
+    }
+
+    return median(std::move(deviations));
+}
+
+double BenchStatistics::mannWhitney(const std::vector<double>& t_first,
+                                    const std::vector<double>& t_second)
+{
+    const double n1{ static_cast<double>(t_first.size()) };
+    const double n2{ static_cast<double>(t_second.size()) };
+    if(n1 < 2 || n2 < 2) {
+        return 1.0;
+    }
+
+    // sample value, true if it belongs to t_first
+    std::vector<std::pair<double, bool>> all;
+    all.reserve(t_first.size() + t_second.size());
+    for(double sample : t_first) {
+        all.emplace_back(sample, true);
+    }
+    for(double sample : t_second) {
+        all.emplace_back(sample, false);
+    }
+    std::sort(std::begin(all), std::end(all));
+
+    // ties get average of their ranks
+    double rankSum{ 0.0 };
+    double tieCorrection{ 0.0 };
+    for(size_t i = 0; i < all.size(); ) {
+        size_t j = i;
+        while(j < all.size() && all[j].first == all[i].first) {
+            ++j;
+        }
+
+        const double rank{ (i + 1 + j) / 2.0 };
+        for(size_t k = i; k < j; ++k) {
+            if(all[k].second) {
+                rankSum += rank;
+            }
+        }
+
+        const double ties{ static_cast<double>(j - i) };
+        tieCorrection += ties * ties * ties - ties;
+        i = j;
+    }
+
+    const double n{ n1 + n2 };
+    const double u{ rankSum - n1 * (n1 + 1) / 2.0 };
+    const double mean{ n1 * n2 / 2.0 };
+    const double variance{ n1 * n2 / 12.0 * ((n + 1) - tieCorrection / (n * (n - 1))) };
+    if(variance <= 0.0) {
+        return 1.0; // all samples equal
+    }
+
+    // continuity correction
+    const double diff{ std::abs(u - mean) - 0.5 };
+    const double z{ std::max(0.0, diff) / std::sqrt(variance) };
+
+    return std::erfc(z / std::sqrt(2.0));
+}
@@ -0,0 +1,18 @@
+#ifndef BENCHSTATISTICS_H
+#define BENCHSTATISTICS_H
+
+#include <vector>
+
+namespace BenchStatistics {
+    double median(std::vector<double> t_samples);
+
+    // median absolute deviation, robust spread of samples
+    double mad(const std::vector<double>& t_samples);
+
+    // two-sided p-value of Mann-Whitney U test, normal approximation
+    // with tie correction; 1.0 if there are not enough samples
+    double mannWhitney(const std::vector<double>& t_first,
+                       const std::vector<double>& t_second);
+}
+
+#endif // BENCHSTATISTICS_H
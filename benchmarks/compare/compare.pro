@@ -0,0 +1,28 @@
+#-------------------------------------------------
+#
+# Compares two result files of qtchess_benchmarks
+#
+# benchcompare [--threshold 5] [--alpha 0.05] baseline.json current.json
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+CONFIG += c++14 console
+CONFIG -= app_bundle
+
+TARGET = benchcompare
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+QMAKE_CXXFLAGS += -Wall
+QMAKE_CXXFLAGS += -Wextra
+
+SOURCES += \
+    main.cpp \
+    benchstatistics.cpp
+
+HEADERS += \
+    benchstatistics.h
@@ -0,0 +1,146 @@
+#include "benchstatistics.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMap>
+#include <QTextStream>
+
+#include <vector>
+
+namespace {
+    enum ExitCode : int {
+        Success    = 0,
+        Regression = 1,
+        BadInput   = 2
+    };
+
+    // benchmark name -> per-op samples in ns
+    using Results = QMap<QString, std::vector<double>>;
+
+    bool load(const QString& t_fileName, Results& t_results, QString& t_revision) {
+        QFile file{ t_fileName };
+        if(!file.open(QIODevice::ReadOnly)) {
+            QTextStream(stderr) << "cannot read " << t_fileName << '\n';
+            return false;
+        }
+
+        const QJsonDocument document{ QJsonDocument::fromJson(file.readAll()) };
+        if(!document.isObject()) {
+            QTextStream(stderr) << t_fileName << " is not a benchmark result\n";
+            return false;
+        }
+
+        const QJsonObject root{ document.object() };
+        t_revision = root.value("context").toObject().value("revision").toString();
+
+        for(const QJsonValue& benchmark : root.value("benchmarks").toArray()) {
+            const QJsonObject object{ benchmark.toObject() };
+
+            std::vector<double> samples;
+            for(const QJsonValue& sample : object.value("samplesNs").toArray()) {
+                samples.push_back(sample.toDouble());
+            }
+            t_results.insert(object.value("name").toString(), samples);
+        }
+
+        return true;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("benchcompare");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Compares two qtchess_benchmarks results.\n"
+                                     "Exits with 1 if any benchmark regressed.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("baseline", "Result file of the baseline run.");
+    parser.addPositionalArgument("current",  "Result file of the compared run.");
+
+    const QCommandLineOption thresholdOption{ "threshold", "Slowdown of median in percent treated as regression.",
+                                              "percent", "5" };
+    const QCommandLineOption alphaOption{ "alpha", "Significance level of Mann-Whitney test.",
+                                          "p", "0.05" };
+    parser.addOption(thresholdOption);
+    parser.addOption(alphaOption);
+    parser.process(app);
+
+    const QStringList files{ parser.positionalArguments() };
+    if(files.size() != 2) {
+        parser.showHelp(BadInput);
+    }
+
+    const double threshold{ parser.value(thresholdOption).toDouble() };
+    const double alpha{ parser.value(alphaOption).toDouble() };
+
+    Results baseline, current;
+    QString baselineRevision, currentRevision;
+    if(!load(files.at(0), baseline, baselineRevision) ||
+       !load(files.at(1), current, currentRevision)
+    ) {
+        return BadInput;
+    }
+
+    QTextStream out(stdout);
+    out << "baseline " << baselineRevision << ", current " << currentRevision << '\n';
+    out << QString("%1 %2 %3 %4 %5  %6\n")
+           .arg("benchmark", -40)
+           .arg("base ns", 12)
+           .arg("curr ns", 12)
+           .arg("change", 9)
+           .arg("p", 7)
+           .arg("");
+
+    int regressions = 0;
+    for(auto it = current.cbegin(); it != current.cend(); ++it) {
+        const auto base = baseline.constFind(it.key());
+        if(base == baseline.cend()) {
+            out << QString("%1 %2\n").arg(it.key(), -40).arg("new");
+            continue;
+        }
+
+        const double baseMedian{ BenchStatistics::median(*base) };
+        const double currMedian{ BenchStatistics::median(*it) };
+        const double change{ baseMedian > 0.0 ? (currMedian / baseMedian - 1.0) * 100.0 : 0.0 };
+        const double p{ BenchStatistics::mannWhitney(*base, *it) };
+
+        // noisy runs - spread larger than the threshold itself
+        const bool noisy{ BenchStatistics::mad(*it) > currMedian * threshold / 100.0 };
+
+        QString verdict;
+        if(p < alpha && change > threshold) {
+            verdict = "REGRESSION";
+            ++regressions;
+        }
+        else if(p < alpha && change < -threshold) {
+            verdict = "faster";
+        }
+        if(noisy) {
+            verdict += verdict.isEmpty() ? "noisy" : " (noisy)";
+        }
+
+        out << QString("%1 %2 %3 %4% %5  %6\n")
+               .arg(it.key(), -40)
+               .arg(baseMedian, 12, 'f', 1)
+               .arg(currMedian, 12, 'f', 1)
+               .arg(change, 8, 'f', 1)
+               .arg(p, 7, 'f', 4)
+               .arg(verdict);
+    }
+
+    for(auto it = baseline.cbegin(); it != baseline.cend(); ++it) {
+        if(!current.contains(it.key())) {
+            out << QString("%1 %2\n").arg(it.key(), -40).arg("removed");
+        }
+    }
+
+    out << regressions << " regression(s) above " << threshold << "%\n";
+
+    return regressions > 0 ? Regression : Success;
+}
@@ -0,0 +1,61 @@
+#-------------------------------------------------
+#
+# Differential check of the QtChess move generator
+# against a reference generator, static exchange
+# evaluation of known positions
+#
+# qtchess_movegen_diff [--jobs N] [--positions N] [--seed N]
+#
+#-------------------------------------------------
+
+QT       += core gui widgets concurrent
+
+CONFIG += c++14 console
+CONFIG -= app_bundle
+
+TARGET = qtchess_movegen_diff
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+DEFINES += QTCHESS_BENCHMARK
+
+QMAKE_CXXFLAGS += -Wall
+QMAKE_CXXFLAGS += -Wextra
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    main.cpp \
+    ../boardsetup.cpp \
+    ../../chesspiece.cpp \
+    ../../movements.cpp \
+    ../../promotiondialog.cpp \
+    ../../paths.cpp \
+    ../../sprites.cpp \
+    ../../board.cpp \
+    ../../piecepool.cpp \
+    ../../enddialog.cpp \
+    ../../chess_namespaces.cpp \
+    ../../material.cpp
+
+HEADERS += \
+    ../boardsetup.h \
+    ../../chesspiece.h \
+    ../../movements.h \
+    ../../promotiondialog.h \
+    ../../paths.h \
+    ../../sprites.h \
+    ../../board.h \
+    ../../piecepool.h \
+    ../../enddialog.h \
+    ../../chess_namespaces.h \
+    ../../material.h \
+    ../../statistics.h \
+    ../../trace.h
+
+FORMS += \
+    ../../promotiondialog.ui \
+    ../../enddialog.ui
+
+RESOURCES += \
+    ../../resources.qrc
@@ -0,0 +1,796 @@
+#include "../boardsetup.h"
+
+#include "../../chess_namespaces.h"
+#include "../../chesspiece.h"
+#include "../../movements.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QProcess>
+#include <QThread>
+#include <QTextStream>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+    // from x, from y, destination x, destination y, MoveType
+    using MoveKey = std::tuple<int, int, int, int, int>;
+    using MoveSet = std::set<MoveKey>;
+
+    enum ExitCode : int {
+        Success    = 0,
+        Divergence = 1,
+        BadInput   = 2
+    };
+
+    bool isCapture(MoveType t_type) noexcept {
+        return t_type == MoveType::Attack    ||
+               t_type == MoveType::EnPassant ||
+               t_type == MoveType::PromotionAttack;
+    }
+
+    MoveSet generate(ChessPiece* t_piece, MoveGenType t_genType) {
+        BenchmarkAccess::clearMoves();
+        BenchmarkAccess::findValidMoves(t_piece, t_genType);
+
+        MoveSet moves;
+        for(const auto& move : BenchmarkAccess::moves()) {
+            moves.emplace(static_cast<int>(t_piece->m_lastPos.x()),
+                          static_cast<int>(t_piece->m_lastPos.y()),
+                          static_cast<int>(move->m_coordinates.x()),
+                          static_cast<int>(move->m_coordinates.y()),
+                          static_cast<int>(move->m_type));
+        }
+        BenchmarkAccess::clearMoves();
+
+        return moves;
+    }
+
+    // random but valid position - kings not adjacent, no pawns on last ranks;
+    // castling rights and en passant are set whenever the placement allows them
+    class PositionGenerator
+    {
+    public:
+        explicit PositionGenerator(quint64 t_seed) : m_random(t_seed) {}
+
+        QString next() {
+            for(auto& rank : m_board) {
+                rank.fill('.');
+            }
+
+            const bool white{ chance(2) };
+
+            // kings on their initial fields make castling possible
+            if(chance(3)) {
+                m_board[7][4] = 'K';
+                m_board[0][4] = 'k';
+            }
+            else {
+                placeKings();
+            }
+
+            for(const char side : { 'w', 'b' }) {
+                const int count{ uniform(0, 14) };
+                for(int i = 0; i < count; ++i) {
+                    placePiece(side);
+                }
+            }
+
+            QString fen;
+            for(int row = 0; row < 8; ++row) {
+                int empty = 0;
+                for(int col = 0; col < 8; ++col) {
+                    if(m_board[row][col] == '.') {
+                        ++empty;
+                        continue;
+                    }
+                    if(empty > 0) {
+                        fen += QString::number(empty);
+                        empty = 0;
+                    }
+                    fen += QChar(m_board[row][col]);
+                }
+                if(empty > 0) {
+                    fen += QString::number(empty);
+                }
+                if(row != 7) {
+                    fen += '/';
+                }
+            }
+
+            fen += white ? " w " : " b ";
+            fen += castling();
+            fen += ' ';
+            fen += enPassant(white);
+            fen += " 0 1";
+
+            return fen;
+        }
+
+    private:
+        std::mt19937_64 m_random;
+        std::array<std::array<char, 8>, 8> m_board; // [0] is rank 8
+
+        int uniform(int t_min, int t_max) {
+            return std::uniform_int_distribution<int>(t_min, t_max)(m_random);
+        }
+
+        bool chance(int t_oneIn) {
+            return uniform(1, t_oneIn) == 1;
+        }
+
+        void placeKings() {
+            const int wRow{ uniform(0, 7) }, wCol{ uniform(0, 7) };
+            m_board[wRow][wCol] = 'K';
+
+            for(;;) {
+                const int bRow{ uniform(0, 7) }, bCol{ uniform(0, 7) };
+                if(std::abs(bRow - wRow) > 1 || std::abs(bCol - wCol) > 1) {
+                    m_board[bRow][bCol] = 'k';
+                    return;
+                }
+            }
+        }
+
+        void placePiece(char t_side) {
+            // rooks often in corners to allow castling, pawns often on
+            // 7th rank to allow promotion
+            static const char pieces[] = "pppppnnbbrrrq";
+            const char piece{ pieces[uniform(0, sizeof(pieces) - 2)] };
+
+            for(int attempt = 0; attempt < 16; ++attempt) {
+                int row{ uniform(0, 7) }, col{ uniform(0, 7) };
+
+                if(piece == 'r' && chance(2)) {
+                    row = t_side == 'w' ? 7 : 0;
+                    col = chance(2) ? 0 : 7;
+                }
+                if(piece == 'p') {
+                    row = chance(4) ? (t_side == 'w' ? 1 : 6) : uniform(1, 6);
+                }
+
+                if(m_board[row][col] == '.') {
+                    m_board[row][col] = t_side == 'w' ? QChar(piece).toUpper().toLatin1() : piece;
+                    return;
+                }
+            }
+        }
+
+        QString castling() {
+            QString rights;
+            if(m_board[7][4] == 'K') {
+                if(m_board[7][7] == 'R' && !chance(4)) rights += 'K';
+                if(m_board[7][0] == 'R' && !chance(4)) rights += 'Q';
+            }
+            if(m_board[0][4] == 'k') {
+                if(m_board[0][7] == 'r' && !chance(4)) rights += 'k';
+                if(m_board[0][0] == 'r' && !chance(4)) rights += 'q';
+            }
+            return rights.isEmpty() ? "-" : rights;
+        }
+
+        // pawn of the side which has just moved, which could have made double step
+        QString enPassant(bool t_whiteToMove) {
+            const char pawn{ t_whiteToMove ? 'p' : 'P' };
+            const int pawnRow{ t_whiteToMove ? 3 : 4 };
+            const int passedRow{ t_whiteToMove ? 2 : 5 };
+            const int startRow{ t_whiteToMove ? 1 : 6 };
+
+            std::vector<int> files;
+            for(int col = 0; col < 8; ++col) {
+                if(m_board[pawnRow][col] == pawn &&
+                   m_board[passedRow][col] == '.' &&
+                   m_board[startRow][col] == '.'
+                ) {
+                    files.push_back(col);
+                }
+            }
+            if(files.empty() || chance(2)) {
+                return "-";
+            }
+
+            const int file{ files[uniform(0, static_cast<int>(files.size()) - 1)] };
+            return QString(QChar('a' + file)) + QString::number(8 - passedRow);
+        }
+    };
+
+    // Independent legal move generator on a plain board array. It shares
+    // no code with ChessPiece, so the game's moves are checked against a
+    // second implementation of the rules, not only against themselves.
+    class ReferenceBoard
+    {
+    public:
+        explicit ReferenceBoard(const QString& t_fen) {
+            std::istringstream fen{ t_fen.toStdString() };
+            std::string placement, side, castling, enPassant;
+            fen >> placement >> side >> castling >> enPassant;
+
+            for(auto& rank : m_board) {
+                rank.fill('.');
+            }
+
+            int row = 0, col = 0;
+            for(const char c : placement) {
+                if(c == '/') {
+                    ++row;
+                    col = 0;
+                }
+                else if(c >= '1' && c <= '8') {
+                    col += c - '0';
+                }
+                else if(onBoard(row, col)) {
+                    m_board[row][col++] = c;
+                }
+            }
+
+            m_white    = side != "b";
+            m_castling = castling;
+            if(enPassant.size() == 2) {
+                m_epCol = enPassant[0] - 'a';
+                m_epRow = '8' - enPassant[1];
+            }
+        }
+
+        // legal moves of the side to move, as compare() collects them
+        MoveSet legalMoves() const {
+            MoveSet moves;
+            for(int row = 0; row < 8; ++row) {
+                for(int col = 0; col < 8; ++col) {
+                    if(isOwn(m_board[row][col])) {
+                        pieceMoves(row, col, moves);
+                    }
+                }
+            }
+            return moves;
+        }
+
+    private:
+        using Board = std::array<std::array<char, 8>, 8>;
+
+        Board m_board; // [0] is rank 8, '.' is empty
+        bool m_white{ true };
+        std::string m_castling;
+        int m_epRow{ -1 }, m_epCol{ -1 };
+
+        // {row, col} steps, straight ones first
+        static constexpr int kingSteps[8][2] = {
+            {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {-1, 1}, {1, -1}, {1, 1}
+        };
+        static constexpr int knightJumps[8][2] = {
+            {-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}
+        };
+
+        static bool onBoard(int t_row, int t_col) noexcept {
+            return t_row >= 0 && t_row < 8 && t_col >= 0 && t_col < 8;
+        }
+
+        static bool isWhite(char t_piece) noexcept {
+            return t_piece >= 'A' && t_piece <= 'Z';
+        }
+
+        bool isOwn(char t_piece) const noexcept {
+            return t_piece != '.' && isWhite(t_piece) == m_white;
+        }
+
+        bool isEnemy(char t_piece) const noexcept {
+            return t_piece != '.' && isWhite(t_piece) != m_white;
+        }
+
+        static bool attacked(const Board& t_board, int t_row, int t_col, bool t_byWhite) noexcept {
+            // t_piece given in upper case
+            auto is = [&](int r, int c, char t_piece) {
+                return onBoard(r, c) &&
+                       t_board[r][c] == (t_byWhite ? t_piece :
+                                                     static_cast<char>(std::tolower(t_piece)));
+            };
+
+            // white pawns attack towards rank 8
+            const int pawnRow{ t_byWhite ? t_row + 1 : t_row - 1 };
+            if(is(pawnRow, t_col - 1, 'P') || is(pawnRow, t_col + 1, 'P')) {
+                return true;
+            }
+
+            for(const auto& jump : knightJumps) {
+                if(is(t_row + jump[0], t_col + jump[1], 'N')) {
+                    return true;
+                }
+            }
+
+            for(const auto& step : kingSteps) {
+                if(is(t_row + step[0], t_col + step[1], 'K')) {
+                    return true;
+                }
+
+                int r{ t_row + step[0] }, c{ t_col + step[1] };
+                while(onBoard(r, c) && t_board[r][c] == '.') {
+                    r += step[0];
+                    c += step[1];
+                }
+
+                const bool diagonal{ step[0] != 0 && step[1] != 0 };
+                if(is(r, c, 'Q') || is(r, c, diagonal ? 'B' : 'R')) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool kingAttacked(const Board& t_board) const noexcept {
+            const char king{ m_white ? 'K' : 'k' };
+            for(int row = 0; row < 8; ++row) {
+                for(int col = 0; col < 8; ++col) {
+                    if(t_board[row][col] == king) {
+                        return attacked(t_board, row, col, !m_white);
+                    }
+                }
+            }
+            return false;
+        }
+
+        static MoveKey key(int t_fromRow, int t_fromCol, int t_toRow, int t_toCol, MoveType t_type) {
+            const int width { static_cast<int>(BoardSizes::FieldWidth) };
+            const int height{ static_cast<int>(BoardSizes::FieldHeight) };
+            return MoveKey{ t_fromCol * width, t_fromRow * height,
+                            t_toCol * width,   t_toRow * height,
+                            static_cast<int>(t_type) };
+        }
+
+        // adds move if it does not leave own king in check
+        void tryMove(int t_fromRow, int t_fromCol, int t_toRow, int t_toCol,
+                     MoveType t_type, MoveSet& t_moves) const
+        {
+            Board board{ m_board };
+            board[t_toRow][t_toCol]     = board[t_fromRow][t_fromCol];
+            board[t_fromRow][t_fromCol] = '.';
+            if(t_type == MoveType::EnPassant) {
+                board[t_fromRow][t_toCol] = '.';
+            }
+
+            if(!kingAttacked(board)) {
+                t_moves.insert(key(t_fromRow, t_fromCol, t_toRow, t_toCol, t_type));
+            }
+        }
+
+        void stepTo(int t_row, int t_col, int t_toRow, int t_toCol, MoveSet& t_moves) const {
+            if(!onBoard(t_toRow, t_toCol) || isOwn(m_board[t_toRow][t_toCol])) {
+                return;
+            }
+            tryMove(t_row, t_col, t_toRow, t_toCol,
+                    isEnemy(m_board[t_toRow][t_toCol]) ? MoveType::Attack : MoveType::Move,
+                    t_moves);
+        }
+
+        void pieceMoves(int t_row, int t_col, MoveSet& t_moves) const {
+            switch (std::tolower(m_board[t_row][t_col])) {
+                case 'p':
+                    pawnMoves(t_row, t_col, t_moves);
+                    break;
+                case 'n':
+                    for(const auto& jump : knightJumps) {
+                        stepTo(t_row, t_col, t_row + jump[0], t_col + jump[1], t_moves);
+                    }
+                    break;
+                case 'k':
+                    for(const auto& step : kingSteps) {
+                        stepTo(t_row, t_col, t_row + step[0], t_col + step[1], t_moves);
+                    }
+                    castleMoves(t_row, t_col, t_moves);
+                    break;
+                case 'b':
+                    slide(t_row, t_col, 4, 8, t_moves);
+                    break;
+                case 'r':
+                    slide(t_row, t_col, 0, 4, t_moves);
+                    break;
+                case 'q':
+                    slide(t_row, t_col, 0, 8, t_moves);
+                    break;
+            }
+        }
+
+        // kingSteps in [t_first, t_last) give directions of the slider
+        void slide(int t_row, int t_col, int t_first, int t_last, MoveSet& t_moves) const {
+            for(int i = t_first; i < t_last; ++i) {
+                int r{ t_row + kingSteps[i][0] }, c{ t_col + kingSteps[i][1] };
+                while(onBoard(r, c)) {
+                    stepTo(t_row, t_col, r, c, t_moves);
+                    if(m_board[r][c] != '.') {
+                        break;
+                    }
+                    r += kingSteps[i][0];
+                    c += kingSteps[i][1];
+                }
+            }
+        }
+
+        void pawnMoves(int t_row, int t_col, MoveSet& t_moves) const {
+            const int direction{ m_white ? -1 : 1 };
+            const int startRow { m_white ? 6 : 1 };
+            const int lastRow  { m_white ? 0 : 7 };
+
+            // pawns never stand on the last rank, next row is on board
+            const int next{ t_row + direction };
+
+            if(m_board[next][t_col] == '.') {
+                tryMove(t_row, t_col, next, t_col,
+                        next == lastRow ? MoveType::PromotionMove : MoveType::Move,
+                        t_moves);
+
+                if(t_row == startRow && m_board[next + direction][t_col] == '.') {
+                    tryMove(t_row, t_col, next + direction, t_col, MoveType::Move, t_moves);
+                }
+            }
+
+            for(const int side : { -1, 1 }) {
+                const int col{ t_col + side };
+                if(!onBoard(next, col)) {
+                    continue;
+                }
+
+                if(isEnemy(m_board[next][col])) {
+                    tryMove(t_row, t_col, next, col,
+                            next == lastRow ? MoveType::PromotionAttack : MoveType::Attack,
+                            t_moves);
+                }
+                else if(next == m_epRow && col == m_epCol) {
+                    tryMove(t_row, t_col, next, col, MoveType::EnPassant, t_moves);
+                }
+            }
+        }
+
+        void castleMoves(int t_row, int t_col, MoveSet& t_moves) const {
+            const int home{ m_white ? 7 : 0 };
+            if(t_row != home || t_col != 4 || attacked(m_board, home, 4, !m_white)) {
+                return;
+            }
+
+            const char rook{ m_white ? 'R' : 'r' };
+            auto allowed = [&](char t_right, int t_rookCol, std::initializer_list<int> t_empty,
+                               std::initializer_list<int> t_safe) {
+                if(m_castling.find(m_white ? t_right : static_cast<char>(std::tolower(t_right))) ==
+                       std::string::npos ||
+                   m_board[home][t_rookCol] != rook
+                ) {
+                    return false;
+                }
+                for(const int col : t_empty) {
+                    if(m_board[home][col] != '.') {
+                        return false;
+                    }
+                }
+                for(const int col : t_safe) {
+                    if(attacked(m_board, home, col, !m_white)) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            if(allowed('K', 7, { 5, 6 }, { 5, 6 })) {
+                t_moves.insert(key(home, 4, home, 6, MoveType::Castle));
+            }
+            if(allowed('Q', 0, { 1, 2, 3 }, { 2, 3 })) {
+                t_moves.insert(key(home, 4, home, 2, MoveType::Castle));
+            }
+        }
+    };
+
+    constexpr int ReferenceBoard::kingSteps[8][2];
+    constexpr int ReferenceBoard::knightJumps[8][2];
+
+    QString toText(const MoveKey& t_move) {
+        auto square = [](int t_x, int t_y) {
+            const int col{ t_x / static_cast<int>(BoardSizes::FieldWidth) };
+            const int row{ t_y / static_cast<int>(BoardSizes::FieldHeight) };
+            return QString(QChar('a' + col)) + QString::number(8 - row);
+        };
+        return QString("%1%2 (MoveType %3)")
+                .arg(square(std::get<0>(t_move), std::get<1>(t_move)))
+                .arg(square(std::get<2>(t_move), std::get<3>(t_move)))
+                .arg(std::get<4>(t_move));
+    }
+
+    // compares generation of captures, quiets and all moves for every
+    // piece of the side to move, and all of them with ReferenceBoard;
+    // empty string if they agree
+    QString compare(const QString& t_fen, std::array<quint64, 7>& t_seen) {
+        BoardSetup setup{ t_fen };
+        const Player side{ setup.sideToMove() };
+
+        const Container& friendly = side == Player::White ? GameStatus::White::pieces :
+                                                            GameStatus::Black::pieces;
+        const King* enemyKing = side == Player::White ? GameStatus::Black::king :
+                                                        GameStatus::White::king;
+
+        // side which has just moved cannot be in check
+        const bool illegal = std::any_of(std::begin(friendly), std::end(friendly),
+                                         [&](const ChessPiece* piece) {
+                                             return piece->canAttackField(enemyKing->m_lastPos);
+                                         });
+        if(illegal) {
+            return {};
+        }
+        ++t_seen[0];
+
+        MoveSet game;
+        const Container pieces{ friendly };
+        for(ChessPiece* piece : pieces) {
+            const MoveSet all     { generate(piece, MoveGenType::All) };
+            const MoveSet captures{ generate(piece, MoveGenType::Captures) };
+            const MoveSet quiets  { generate(piece, MoveGenType::Quiets) };
+
+            const QString where{ QString("piece at %1,%2: ")
+                                 .arg(piece->m_lastPos.x())
+                                 .arg(piece->m_lastPos.y()) };
+
+            MoveSet merged{ captures };
+            merged.insert(std::begin(quiets), std::end(quiets));
+            if(merged != all || merged.size() != captures.size() + quiets.size()) {
+                return where + "captures + quiets differ from all moves";
+            }
+
+            for(const MoveKey& move : captures) {
+                if(!isCapture(static_cast<MoveType>(std::get<4>(move)))) {
+                    return where + "quiet move generated as capture";
+                }
+            }
+            for(const MoveKey& move : quiets) {
+                if(isCapture(static_cast<MoveType>(std::get<4>(move)))) {
+                    return where + "capture generated as quiet move";
+                }
+            }
+
+            if(piece->haveValidMoves() == all.empty()) {
+                return where + "haveValidMoves disagrees with findValidMoves";
+            }
+
+            for(const MoveKey& move : all) {
+                ++t_seen[static_cast<size_t>(std::get<4>(move))];
+            }
+            game.insert(std::begin(all), std::end(all));
+        }
+
+        const MoveSet reference{ ReferenceBoard(t_fen).legalMoves() };
+        if(game != reference) {
+            MoveSet missing, extra;
+            std::set_difference(std::begin(reference), std::end(reference),
+                                std::begin(game), std::end(game),
+                                std::inserter(missing, std::end(missing)));
+            std::set_difference(std::begin(game), std::end(game),
+                                std::begin(reference), std::end(reference),
+                                std::inserter(extra, std::end(extra)));
+
+            return !missing.empty() ? "legal move not generated: " + toText(*std::begin(missing)) :
+                                      "illegal move generated: " + toText(*std::begin(extra));
+        }
+
+        return {};
+    }
+
+    // positions with known static exchange evaluation; value is
+    // staticExchange for captures, exchangeAfterMove for the rest
+    struct ExchangeCase
+    {
+        const char* name;
+        const char* fen;
+        const char* from;
+        const char* to;
+        MoveType type;
+        bool losing;
+        int value;
+    };
+
+    const std::array<ExchangeCase, 9> exchangeCases{{
+        { "queen takes defended pawn",
+          "4k3/8/3p4/4p3/8/8/4Q3/4K3 w - - 0 1",     "e2", "e5", MoveType::Attack,          true,  -800 },
+        { "x-ray recapture through rook",
+          "k3r3/8/8/4n3/8/8/4R3/K3R3 w - - 0 1",     "e2", "e5", MoveType::Attack,          false,  320 },
+        { "king cannot take defended queen",
+          "4k3/Q3p3/8/8/8/8/8/4R1K1 w - - 0 1",      "a7", "e7", MoveType::Attack,          false,  100 },
+        { "knight moves onto field attacked by pawn",
+          "4k3/8/3p4/8/8/5N2/8/4K3 w - - 0 1",       "f3", "e5", MoveType::Move,            true,  -320 },
+        // en passant trades a pawn for a pawn, it never loses material
+        { "en passant onto field defended by pawn",
+          "4k3/2p5/8/3pP3/8/8/8/4K3 w - d6 0 2",     "e5", "d6", MoveType::EnPassant,       false,    0 },
+        { "en passant opens file for recapture",
+          "3rk3/8/8/3pP3/8/8/8/3RK3 w - d6 0 2",     "e5", "d6", MoveType::EnPassant,       false,  100 },
+        // promotion is not counted, pawn is worth a pawn
+        { "promotion capture of defended rook",
+          "r3k3/1Pn5/8/8/8/8/8/4K3 w - - 0 1",       "b7", "a8", MoveType::PromotionAttack, false,  400 },
+        { "promotion onto field attacked by knight",
+          "4k3/1P6/n7/8/8/8/8/4K3 w - - 0 1",        "b7", "b8", MoveType::PromotionMove,   true,  -100 },
+        { "quiet move onto safe field",
+          "4k3/8/8/8/8/5N2/8/4K3 w - - 0 1",         "f3", "e5", MoveType::Move,            false,    0 }
+    }};
+
+    QPointF toField(const char* t_square) noexcept {
+        return { (t_square[0] - 'a') * BoardSizes::FieldWidth,
+                 (BoardSizes::MaxRowCount - (t_square[1] - '0')) * BoardSizes::FieldHeight };
+    }
+
+    ChessPiece* pieceAt(const QPointF& t_pos) noexcept {
+        for(auto* pieces : { &GameStatus::White::pieces, &GameStatus::Black::pieces }) {
+            for(ChessPiece* piece : *pieces) {
+                if(piece->m_lastPos == t_pos) {
+                    return piece;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    // empty string if evaluation matches t_case
+    QString checkExchange(const ExchangeCase& t_case) {
+        BoardSetup setup{ t_case.fen };
+
+        const QPointF from{ toField(t_case.from) };
+        const QPointF to  { toField(t_case.to) };
+
+        ChessPiece* piece{ pieceAt(from) };
+        if(!piece) {
+            return "no piece on " + QString(t_case.from);
+        }
+
+        BenchmarkAccess::clearMoves();
+        BenchmarkAccess::findValidMoves(piece, MoveGenType::All);
+
+        const auto& moves = BenchmarkAccess::moves();
+        auto move = std::find_if(std::begin(moves), std::end(moves),
+                                 [&](const std::unique_ptr<Movement>& m) {
+                                     return m->m_coordinates == to;
+                                 });
+        if(move == std::end(moves) || (*move)->m_type != t_case.type) {
+            BenchmarkAccess::clearMoves();
+            return "move not generated";
+        }
+
+        (*move)->evaluateExchange();
+        const bool losing{ (*move)->m_losing };
+        BenchmarkAccess::clearMoves();
+
+        if(losing != t_case.losing) {
+            return losing ? "marked as losing" : "not marked as losing";
+        }
+
+        int value{ 0 };
+        switch (t_case.type) {
+            case MoveType::Attack:
+            case MoveType::PromotionAttack:
+                value = ChessPiece::staticExchange(piece, pieceAt(to));
+                break;
+            case MoveType::EnPassant:
+                value = ChessPiece::staticExchange(piece, pieceAt({ to.x(), from.y() }), to);
+                break;
+            default:
+                value = piece->exchangeAfterMove(to);
+                break;
+        }
+        if(value != t_case.value) {
+            return QString("value %1, expected %2").arg(value).arg(t_case.value);
+        }
+
+        return {};
+    }
+
+    int checkExchanges() {
+        QTextStream out(stdout);
+
+        int result = Success;
+        for(const ExchangeCase& exchange : exchangeCases) {
+            const QString error{ checkExchange(exchange) };
+            if(!error.isEmpty()) {
+                out << "static exchange, " << exchange.name << ": " << error << '\n';
+                result = Divergence;
+            }
+        }
+
+        if(result == Success) {
+            out << "static exchange: " << exchangeCases.size() << " positions\n";
+        }
+        return result;
+    }
+
+    int runWorker(quint64 t_seed, quint64 t_positions) {
+        QTextStream out(stdout);
+        PositionGenerator generator{ t_seed };
+
+        // [0] - positions, rest indexed by MoveType
+        std::array<quint64, 7> seen{};
+        for(quint64 i = 0; i < t_positions; ++i) {
+            const QString fen{ generator.next() };
+            const QString divergence{ compare(fen, seen) };
+            if(!divergence.isEmpty()) {
+                out << "divergence in " << fen << "\n  " << divergence << '\n';
+                return Divergence;
+            }
+        }
+
+        out << "seed " << t_seed << ": " << seen[0] << " positions,"
+            << " moves "             << seen[static_cast<size_t>(MoveType::Move)]
+            << " attacks "           << seen[static_cast<size_t>(MoveType::Attack)]
+            << " castles "           << seen[static_cast<size_t>(MoveType::Castle)]
+            << " en passant "        << seen[static_cast<size_t>(MoveType::EnPassant)]
+            << " promotions "        << seen[static_cast<size_t>(MoveType::PromotionMove)]
+            << " promotion attacks " << seen[static_cast<size_t>(MoveType::PromotionAttack)]
+            << '\n';
+
+        return Success;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // board is never shown
+    if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("qtchess_movegen_diff");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Compares move generation paths on random positions with\n"
+                                     "each other and with a reference generator, and checks static\n"
+                                     "exchange evaluation of known positions.\n"
+                                     "Exits with 1 and prints the position on first divergence.");
+    parser.addHelpOption();
+
+    const QCommandLineOption positionsOption{ "positions", "Number of positions per worker.", "count", "100000" };
+    const QCommandLineOption seedOption{ "seed", "Seed of the first worker.", "seed", "1" };
+    const QCommandLineOption jobsOption{ "jobs", "Number of worker processes.", "count",
+                                         QString::number(std::max(1, QThread::idealThreadCount())) };
+    const QCommandLineOption workerOption{ "worker", "Run in this process, used internally." };
+    parser.addOption(positionsOption);
+    parser.addOption(seedOption);
+    parser.addOption(jobsOption);
+    parser.addOption(workerOption);
+    parser.process(app);
+
+    const quint64 positions{ parser.value(positionsOption).toULongLong() };
+    const quint64 seed{ parser.value(seedOption).toULongLong() };
+    const int jobs{ parser.value(jobsOption).toInt() };
+    if(jobs < 1) {
+        QTextStream(stderr) << "invalid number of jobs\n";
+        return BadInput;
+    }
+
+    if(!parser.isSet(workerOption) && checkExchanges() != Success) {
+        return Divergence;
+    }
+
+    // GameStatus is global, so positions are checked in separate processes
+    if(parser.isSet(workerOption) || jobs == 1) {
+        return runWorker(seed, positions);
+    }
+
+    std::vector<std::unique_ptr<QProcess>> workers;
+    for(int i = 0; i < jobs; ++i) {
+        workers.emplace_back(new QProcess);
+        workers.back()->setProcessChannelMode(QProcess::ForwardedChannels);
+        workers.back()->start(QCoreApplication::applicationFilePath(),
+                              { "--worker",
+                                "--positions", QString::number(positions),
+                                "--seed",      QString::number(seed + static_cast<quint64>(i)) });
+    }
+
+    int result = Success;
+    for(auto& worker : workers) {
+        worker->waitForFinished(-1);
+        if(worker->exitStatus() != QProcess::NormalExit || worker->exitCode() != Success) {
+            result = Divergence;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,353 @@
+#include "boardsetup.h"
+#include "compare/benchstatistics.h"
+
+#include "../chess_namespaces.h"
+#include "../chesspiece.h"
+
+#ifdef QTCHESS_ALLOCATIONS
+#include "../allocations.h"
+#endif
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#ifndef QTCHESS_REVISION
+#define QTCHESS_REVISION "unknown"
+#endif
+
+namespace {
+    struct Corpus
+    {
+        const char* name;
+        const char* fen;
+    };
+
+    // representative positions - opening, middle game, tactics, endgame
+    const std::array<Corpus, 5> corpus{{
+        { "start",      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1" },
+        { "italian",    "r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq - 4 4" },
+        { "kiwipete",   "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1" },
+        { "endgame",    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1" },
+        { "promotion",  "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1" }
+    }};
+
+    const std::array<std::pair<PieceType, const char*>, 6> pieceTypes{{
+        { PieceType::Pawn,   "Pawn"   },
+        { PieceType::Knight, "Knight" },
+        { PieceType::Bishop, "Bishop" },
+        { PieceType::Rook,   "Rook"   },
+        { PieceType::Queen,  "Queen"  },
+        { PieceType::King,   "King"   }
+    }};
+
+    struct Options
+    {
+        QString filter;
+        int samples{ 15 };
+        qint64 sampleNs{ 20 * 1000 * 1000 }; // minimal duration of one sample
+    };
+
+    // runs t_op repeatedly, every sample is average time of one op in ns
+    template<typename Op>
+    QJsonObject measure(const QString& t_name,
+                        int t_callsPerOp,
+                        const Options& t_options,
+                        Op&& t_op)
+    {
+        // find number of iterations filling one sample
+        qint64 iterations = 1;
+        for(;;) {
+            QElapsedTimer timer;
+            timer.start();
+            for(qint64 i = 0; i < iterations; ++i) {
+                t_op();
+            }
+            if(timer.nsecsElapsed() >= t_options.sampleNs) {
+                break;
+            }
+            iterations *= 2;
+        }
+
+#ifdef QTCHESS_ALLOCATIONS
+        // counted apart from samples; counting operator new still runs
+        // during samples, so timings differ from a default build
+        const Allocations::Counters before{ Allocations::current() };
+        for(qint64 i = 0; i < iterations; ++i) {
+            t_op();
+        }
+        const Allocations::Counters after{ Allocations::current() };
+#endif
+
+        std::vector<double> samples;
+        samples.reserve(static_cast<size_t>(t_options.samples));
+        for(int s = 0; s < t_options.samples; ++s) {
+            QElapsedTimer timer;
+            timer.start();
+            for(qint64 i = 0; i < iterations; ++i) {
+                t_op();
+            }
+            samples.push_back(static_cast<double>(timer.nsecsElapsed()) / iterations);
+        }
+
+        QJsonArray samplesArray;
+        for(double sample : samples) {
+            samplesArray.append(sample);
+        }
+
+        QJsonObject result;
+        result.insert("name",        t_name);
+        result.insert("callsPerOp",  t_callsPerOp);
+        result.insert("iterations",  iterations);
+        result.insert("medianNs",    BenchStatistics::median(samples));
+        result.insert("samplesNs",   samplesArray);
+#ifdef QTCHESS_ALLOCATIONS
+        result.insert("allocationsPerOp",
+                      static_cast<double>(after.allocations - before.allocations) / iterations);
+        result.insert("bytesPerOp",
+                      static_cast<double>(after.bytes - before.bytes) / iterations);
+#endif
+        return result;
+    }
+
+    std::vector<ChessPiece*> piecesOf(PieceType t_type, const Container& t_pieces) {
+        std::vector<ChessPiece*> result;
+        std::copy_if(std::begin(t_pieces), std::end(t_pieces),
+                     std::back_inserter(result),
+                     [&](const ChessPiece* piece) {
+                         return piece->m_type == t_type;
+                     });
+        return result;
+    }
+
+    std::vector<QPointF> allFields() {
+        std::vector<QPointF> fields;
+        for(int y = 0; y < BoardSizes::MaxColCount; ++y) {
+            for(int x = 0; x < BoardSizes::MaxRowCount; ++x) {
+                fields.emplace_back(x * BoardSizes::FieldWidth,
+                                    y * BoardSizes::FieldHeight);
+            }
+        }
+        return fields;
+    }
+
+    void runCorpus(const Corpus& t_position,
+                   const Options& t_options,
+                   QJsonArray& t_results,
+                   std::vector<std::pair<QString, double>>& t_allocating)
+    {
+        BoardSetup setup{ t_position.fen };
+
+        const Player side{ setup.sideToMove() };
+        const Container& friendly = side == Player::White ? GameStatus::White::pieces :
+                                                            GameStatus::Black::pieces;
+        const Container& enemy    = side == Player::White ? GameStatus::Black::pieces :
+                                                            GameStatus::White::pieces;
+        const King* king = side == Player::White ? GameStatus::White::king :
+                                                   GameStatus::Black::king;
+        const King* enemyKing = side == Player::White ? GameStatus::Black::king :
+                                                        GameStatus::White::king;
+        const std::vector<QPointF> fields{ allFields() };
+
+        auto run = [&](const QString& t_name, int t_callsPerOp, auto&& t_op) {
+            const QString name{ t_name + '/' + t_position.name };
+            if(!t_options.filter.isEmpty() && !name.contains(t_options.filter)) {
+                return;
+            }
+            const QJsonObject result{ measure(name, t_callsPerOp, t_options, t_op) };
+
+            const double allocations{ result.value("allocationsPerOp").toDouble() };
+            if(allocations > 0.0) {
+                t_allocating.emplace_back(name, allocations);
+            }
+            t_results.append(result);
+        };
+
+        for(const auto& type : pieceTypes) {
+            const std::vector<ChessPiece*> movers{ piecesOf(type.first, friendly) };
+            if(!movers.empty()) {
+                run(QString{ "findValidMoves/" } + type.second,
+                    static_cast<int>(movers.size()),
+                    [&] {
+                        for(ChessPiece* piece : movers) {
+                            BenchmarkAccess::findValidMoves(piece);
+                        }
+                        BenchmarkAccess::clearMoves();
+                    });
+            }
+
+            std::vector<ChessPiece*> attackers{ piecesOf(type.first, enemy) };
+            attackers.insert(std::end(attackers), std::begin(movers), std::end(movers));
+            if(!attackers.empty()) {
+                run(QString{ "canAttackField/" } + type.second,
+                    static_cast<int>(attackers.size() * fields.size()),
+                    [&] {
+                        for(const ChessPiece* piece : attackers) {
+                            for(const QPointF& field : fields) {
+                                piece->canAttackField(field);
+                            }
+                        }
+                    });
+            }
+        }
+
+        run("checkField", static_cast<int>(fields.size()), [&] {
+            for(const QPointF& field : fields) {
+                BenchmarkAccess::checkField(field, king);
+            }
+        });
+
+        run("inCheckAfterMove", static_cast<int>(friendly.size() * fields.size()), [&] {
+            for(const ChessPiece* piece : friendly) {
+                for(const QPointF& field : fields) {
+                    king->inCheckAfterMove(field, piece->m_lastPos);
+                }
+            }
+        });
+
+        // captures available to the side to move
+        std::vector<std::pair<const ChessPiece*, const ChessPiece*>> captures;
+        for(const ChessPiece* piece : friendly) {
+            for(const ChessPiece* victim : enemy) {
+                if(victim->m_type != PieceType::King &&
+                   piece->canAttackField(victim->m_lastPos)
+                ) {
+                    captures.emplace_back(piece, victim);
+                }
+            }
+        }
+        if(!captures.empty()) {
+            run("staticExchange", static_cast<int>(captures.size()), [&] {
+                for(const auto& capture : captures) {
+                    ChessPiece::staticExchange(capture.first, capture.second);
+                }
+            });
+        }
+
+        // state after the opponent's move, as checked in mouseReleaseEvent
+        run("isGameOver", 1, [&] {
+            BenchmarkAccess::isGameOver(enemyKing);
+        });
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // board is never shown, benchmarks run without display
+    if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("qtchess_benchmarks");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("QtChess move generator benchmarks");
+    parser.addHelpOption();
+
+    const QCommandLineOption filterOption{ "filter", "Run benchmarks containing <text>.", "text" };
+    const QCommandLineOption samplesOption{ "samples", "Number of samples per benchmark.", "count", "15" };
+    const QCommandLineOption outputOption{ "output", "Write JSON results to <file>, - for stdout.", "file" };
+    const QCommandLineOption allocationFreeOption{ "allocation-free",
+                                                   "Fail if benchmarks containing <text> allocate.",
+                                                   "text" };
+    const QCommandLineOption resultsOption{ "results-dir",
+                                            "Directory of timestamped results, used without --output.",
+                                            "dir", "results" };
+    parser.addOption(filterOption);
+    parser.addOption(samplesOption);
+    parser.addOption(outputOption);
+    parser.addOption(resultsOption);
+    parser.addOption(allocationFreeOption);
+    parser.process(app);
+
+#ifndef QTCHESS_ALLOCATIONS
+    if(parser.isSet(allocationFreeOption)) {
+        QTextStream(stderr) << "--allocation-free needs a build with CONFIG+=allocations\n";
+        return 1;
+    }
+#endif
+
+    Options options;
+    options.filter  = parser.value(filterOption);
+    options.samples = std::max(1, parser.value(samplesOption).toInt());
+
+    QJsonArray results;
+    std::vector<std::pair<QString, double>> allocating;
+    for(const auto& position : corpus) {
+        runCorpus(position, options, results, allocating);
+    }
+
+    const QDateTime date{ QDateTime::currentDateTimeUtc() };
+
+    QJsonObject context;
+    context.insert("date",       date.toString(Qt::ISODate));
+    context.insert("revision",   QTCHESS_REVISION);
+    context.insert("qtVersion",  qVersion());
+#ifdef QTCHESS_ALLOCATIONS
+    context.insert("allocations", true);
+#else
+    context.insert("allocations", false);
+#endif
+#ifdef QT_DEBUG
+    context.insert("buildType",  "debug");
+#else
+    context.insert("buildType",  "release");
+#endif
+
+    QJsonObject root;
+    root.insert("context",    context);
+    root.insert("benchmarks", results);
+
+    const QByteArray json{ QJsonDocument(root).toJson() };
+
+    // hot paths which have to stay allocation free
+    int result = 0;
+    for(const QString& pattern : parser.values(allocationFreeOption)) {
+        for(const auto& benchmark : allocating) {
+            if(benchmark.first.contains(pattern)) {
+                QTextStream(stderr) << benchmark.first << " allocates "
+                                    << benchmark.second << " times per op\n";
+                result = 1;
+            }
+        }
+    }
+
+    if(parser.value(outputOption) == "-") {
+        QTextStream(stdout) << json;
+        return result;
+    }
+
+    // every run is kept, so results can be compared with benchcompare
+    QString fileName{ parser.value(outputOption) };
+    if(fileName.isEmpty()) {
+        const QDir dir{ parser.value(resultsOption) };
+        if(!dir.mkpath(".")) {
+            QTextStream(stderr) << "cannot create " << dir.path() << '\n';
+            return 1;
+        }
+        fileName = dir.filePath(date.toString("yyyyMMdd-HHmmss") + ".json");
+    }
+
+    QFile file{ fileName };
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate) ||
+       file.write(json) == -1
+    ) {
+        QTextStream(stderr) << "cannot write " << file.fileName() << '\n';
+        return 1;
+    }
+    QTextStream(stdout) << file.fileName() << '\n';
+
+    return result;
+}
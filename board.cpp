@@ -0,0 +1,132 @@
+#include "board.h"
+
+#include "chess_namespaces.h"
+#include "trace.h"
+
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <QtAlgorithms>
+
+namespace {
+    const QRectF boardRect{ 0, 0, BoardSizes::BoardWidth, BoardSizes::BoardHeight };
+}
+
+void Highlights::add(const QPointF& t_field, const QBrush& t_brush) noexcept {
+    const int i{ Board::fieldIndex(t_field) };
+
+    m_fields |= quint64{ 1 } << i;
+    m_brushes[static_cast<size_t>(i)] = &t_brush;
+}
+
+HighlightOverlay::HighlightOverlay(QGraphicsItem* t_parent)
+    : QGraphicsItem(t_parent)
+{
+    setAcceptedMouseButtons(Qt::NoButton);
+
+    // exposedRect limits repaint to changed fields
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+}
+
+QRectF HighlightOverlay::boundingRect() const {
+    return boardRect;
+}
+
+QPainterPath HighlightOverlay::shape() const {
+    return {};
+}
+
+void HighlightOverlay::paint(QPainter* t_painter,
+                             const QStyleOptionGraphicsItem* t_option,
+                             QWidget* t_widget)
+{
+    Q_UNUSED(t_widget);
+    TRACE_SCOPE("HighlightOverlay::paint");
+
+    for(quint64 fields = m_highlights.m_fields; fields != 0; fields &= fields - 1) {
+        const int i{ static_cast<int>(qCountTrailingZeroBits(fields)) };
+
+        const QRectF rect{ Board::fieldRect(i) };
+        if(rect.intersects(t_option->exposedRect)) {
+            t_painter->fillRect(rect, *m_highlights.m_brushes[static_cast<size_t>(i)]);
+        }
+    }
+}
+
+void HighlightOverlay::setHighlights(const Highlights& t_highlights) {
+    // fields added, removed or highlighted with other brush
+    quint64 dirty{ m_highlights.m_fields ^ t_highlights.m_fields };
+    for(quint64 both = m_highlights.m_fields & t_highlights.m_fields; both != 0; both &= both - 1) {
+        const size_t i{ qCountTrailingZeroBits(both) };
+        if(m_highlights.m_brushes[i] != t_highlights.m_brushes[i]) {
+            dirty |= quint64{ 1 } << i;
+        }
+    }
+
+    m_highlights = t_highlights;
+
+    for(; dirty != 0; dirty &= dirty - 1) {
+        update(Board::fieldRect(static_cast<int>(qCountTrailingZeroBits(dirty))));
+    }
+}
+
+void HighlightOverlay::clear() {
+    setHighlights({});
+}
+
+Board::Board(QGraphicsItem* t_parent)
+    : QGraphicsItem(t_parent),
+      m_overlay(new HighlightOverlay(this))
+{
+    setAcceptedMouseButtons(Qt::NoButton);
+    setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+}
+
+QRectF Board::boundingRect() const {
+    return boardRect;
+}
+
+void Board::paint(QPainter* t_painter,
+                  const QStyleOptionGraphicsItem* t_option,
+                  QWidget* t_widget)
+{
+    Q_UNUSED(t_option);
+    Q_UNUSED(t_widget);
+    TRACE_SCOPE("Board::paint");
+
+    t_painter->fillRect(boardRect, BoardBrush::White);
+
+    // top-left field is white
+    for(int i = 0; i < Highlights::FieldCount; ++i) {
+        const int x{ i % BoardSizes::MaxRowCount };
+        const int y{ i / BoardSizes::MaxRowCount };
+
+        if((x + y) % 2 == 1) {
+            t_painter->fillRect(fieldRect(i), BoardBrush::Black);
+        }
+    }
+}
+
+void Board::setHighlights(const Highlights& t_highlights) {
+    m_overlay->setHighlights(t_highlights);
+}
+
+void Board::clearHighlights() {
+    m_overlay->clear();
+}
+
+int Board::fieldIndex(const QPointF& t_field) noexcept {
+    const int x{ static_cast<int>(t_field.x() / BoardSizes::FieldWidth) };
+    const int y{ static_cast<int>(t_field.y() / BoardSizes::FieldHeight) };
+
+    return y * BoardSizes::MaxRowCount + x;
+}
+
+QRectF Board::fieldRect(int t_index) noexcept {
+    const int x{ t_index % BoardSizes::MaxRowCount };
+    const int y{ t_index / BoardSizes::MaxRowCount };
+
+    return { x * BoardSizes::FieldWidth,
+             y * BoardSizes::FieldHeight,
+             BoardSizes::FieldWidth,
+             BoardSizes::FieldHeight };
+}
@@ -0,0 +1,70 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <QBrush>
+#include <QGraphicsItem>
+#include <QPainterPath>
+
+#include <array>
+
+// fields to highlight, bit i of m_fields is field i counted
+// row by row from top-left corner of the board
+struct Highlights
+{
+    static constexpr const int FieldCount = 64;
+
+    quint64 m_fields{ 0 };
+    std::array<const QBrush*, FieldCount> m_brushes{};
+
+    // t_field is top-left corner of field in scene coordinates,
+    // t_brush has to outlive the highlight
+    void add(const QPointF& t_field, const QBrush& t_brush) noexcept;
+};
+
+// highlighted fields drawn over the board,
+// changing highlights repaints only fields which differ
+class HighlightOverlay final : public QGraphicsItem
+{
+public:
+    explicit HighlightOverlay(QGraphicsItem* t_parent = nullptr);
+
+    QRectF boundingRect() const override;
+
+    // empty, so scene queries at a field never return the overlay
+    QPainterPath shape() const override;
+
+    void paint(QPainter* t_painter,
+               const QStyleOptionGraphicsItem* t_option,
+               QWidget* t_widget = nullptr) override;
+
+    void setHighlights(const Highlights& t_highlights);
+    void clear();
+
+private:
+    Highlights m_highlights;
+};
+
+// All 64 fields of the board painted by a single item. Fields never
+// change, so the item is cached; highlights live in a child overlay.
+class Board final : public QGraphicsItem
+{
+public:
+    explicit Board(QGraphicsItem* t_parent = nullptr);
+
+    QRectF boundingRect() const override;
+
+    void paint(QPainter* t_painter,
+               const QStyleOptionGraphicsItem* t_option,
+               QWidget* t_widget = nullptr) override;
+
+    void setHighlights(const Highlights& t_highlights);
+    void clearHighlights();
+
+    static int fieldIndex(const QPointF& t_field) noexcept;
+    static QRectF fieldRect(int t_index) noexcept;
+
+private:
+    HighlightOverlay* m_overlay;
+};
+
+#endif // BOARD_H
@@ -3,24 +3,15 @@
 
 #include <QGraphicsScene>
 
-namespace BoardSizes {
-    constexpr const int MaxColCount = 8;
-    constexpr const int MaxRowCount = 8;
-
-    constexpr const qreal FieldHeight = 48;
-    constexpr const qreal FieldWidth  = 48;
-
-    constexpr const qreal BoardHeight = MaxColCount * FieldHeight;
-    constexpr const qreal BoardWidth  = MaxRowCount * FieldWidth;
-}
-
 namespace GameStatus {
     int uselessMoves{ 0 }; // Fifty moves rule
     Player currentPlayer{ Player::White };
-    std::queue<std::pair<QGraphicsRectItem*, QBrush>> highlighted;
 
-    // pieces detatched from scene
-    std::vector<std::unique_ptr<ChessPiece>> promotedPieces;
+    // fields and their highlight, owned by scene
+    Board* board{ nullptr };
+
+    // pieces of both players currently on board
+    MaterialKey material;
 
     namespace White {
         King* king{ nullptr };
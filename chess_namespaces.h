@@ -1,11 +1,12 @@
 #ifndef CHESS_NAMESPACES_H
 #define CHESS_NAMESPACES_H
 
+#include "material.h"
+
 #include <QBrush>
-#include <QGraphicsItem>
 
-#include <queue>
 #include <memory>
+#include <vector>
 
 enum class PieceType : char {
     King   = 'K', Queen  = 'Q', Rook = 'R',
@@ -24,15 +25,63 @@ enum class MoveType : int {
     Move = 1, Attack, Castle, EnPassant, PromotionMove, PromotionAttack
 };
 
+// moves produced by ChessPiece::findValidMoves
+// captures - Attack, EnPassantAttack, PromotionAttack
+// quiets   - Move, EnPassantMove, PromotionMove, Castle
+enum class MoveGenType : int {
+    Captures = 1, Quiets = 2, All = Captures | Quiets
+};
+
+constexpr bool generatesCaptures(MoveGenType t_genType) noexcept {
+    return static_cast<int>(t_genType) & static_cast<int>(MoveGenType::Captures);
+}
+
+constexpr bool generatesQuiets(MoveGenType t_genType) noexcept {
+    return static_cast<int>(t_genType) & static_cast<int>(MoveGenType::Quiets);
+}
+
+constexpr const int PieceTypeCount = 6;
+
+// slot of a piece type in tables indexed by type, pawn first
+constexpr int pieceIndex(PieceType t_type) noexcept {
+    switch (t_type) {
+        case PieceType::Pawn:   return 0;
+        case PieceType::Knight: return 1;
+        case PieceType::Bishop: return 2;
+        case PieceType::Rook:   return 3;
+        case PieceType::Queen:  return 4;
+        case PieceType::King:   return 5;
+    }
+    return 0;
+}
+
+// slot in tables holding pieces of both players, white pieces first
+constexpr int pieceIndex(PieceType t_type, Player t_player) noexcept {
+    return pieceIndex(t_type) + (t_player == Player::White ? 0 : PieceTypeCount);
+}
+
+// material value used when comparing pieces, e.g. in exchanges
+constexpr int pieceValue(PieceType t_type) noexcept {
+    switch (t_type) {
+        case PieceType::Pawn:   return 100;
+        case PieceType::Knight: return 320;
+        case PieceType::Bishop: return 330;
+        case PieceType::Rook:   return 500;
+        case PieceType::Queen:  return 900;
+        case PieceType::King:   return 20000;
+    }
+    return 0;
+}
+
 namespace BoardSizes {
-    extern const int MaxColCount;
-    extern const int MaxRowCount;
+    constexpr const int MaxColCount = 8;
+    constexpr const int MaxRowCount = 8;
 
-    extern const qreal FieldHeight;
-    extern const qreal FieldWidth;
+    constexpr const qreal FieldHeight = 48;
+    constexpr const qreal FieldWidth  = 48;
 
-    extern const qreal BoardHeight;
-    extern const qreal BoardWidth;
+    constexpr const qreal BoardHeight = MaxColCount * FieldHeight;
+    constexpr const qreal BoardWidth  = MaxRowCount * FieldWidth;
 }
 
 namespace BoardBrush {
@@ -42,14 +91,17 @@ namespace BoardBrush {
 
 class ChessPiece;
 class King;
+class Board;
 
 namespace GameStatus {
     extern int uselessMoves; // Fifty moves rule
     extern Player currentPlayer;
-    extern std::queue<std::pair<QGraphicsRectItem*, QBrush>> highlighted;
 
-    // pieces detatched from scene
-    extern std::vector<std::unique_ptr<ChessPiece>> promotedPieces;
+    // fields and their highlight, owned by scene
+    extern Board* board;
+
+    // pieces of both players currently on board
+    extern MaterialKey material;
 
     namespace White {
         extern King* king;
@@ -61,4 +113,59 @@ namespace GameStatus {
     }
 }
 
+// side dependent constants and containers, resolved at compile time
+// so the move generator can be specialised for each player
+template<Player P>
+struct PlayerTraits;
+
+template<>
+struct PlayerTraits<Player::White>
+{
+    static constexpr Player enemy = Player::Black;
+
+    // white pawns move to the top of the board
+    static constexpr qreal pawnDirection = -BoardSizes::FieldHeight;
+
+    static constexpr bool isLastRow(qreal t_y) noexcept {
+        return t_y < BoardSizes::FieldHeight;
+    }
+
+    static King*& king() noexcept {
+        return GameStatus::White::king;
+    }
+
+    static std::vector<ChessPiece*>& pieces() noexcept {
+        return GameStatus::White::pieces;
+    }
+
+    static std::vector<ChessPiece*>& enemyPieces() noexcept {
+        return GameStatus::Black::pieces;
+    }
+};
+
+template<>
+struct PlayerTraits<Player::Black>
+{
+    static constexpr Player enemy = Player::White;
+
+    // black pawns move to the bottom of the board
+    static constexpr qreal pawnDirection = BoardSizes::FieldHeight;
+
+    static constexpr bool isLastRow(qreal t_y) noexcept {
+        return t_y >= BoardSizes::BoardHeight - BoardSizes::FieldHeight;
+    }
+
+    static King*& king() noexcept {
+        return GameStatus::Black::king;
+    }
+
+    static std::vector<ChessPiece*>& pieces() noexcept {
+        return GameStatus::Black::pieces;
+    }
+
+    static std::vector<ChessPiece*>& enemyPieces() noexcept {
+        return GameStatus::White::pieces;
+    }
+};
+
 #endif // CHESS_NAMESPACES_H
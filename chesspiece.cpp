@@ -1,9 +1,14 @@
 #include "chesspiece.h"
 #include "chess_namespaces.h"
 #include "movements.h"
-#include "paths.h"
+#include "sprites.h"
 #include "promotiondialog.h"
 #include "enddialog.h"
+#include "statistics.h"
+#include "trace.h"
+#include "allocations.h"
+#include "board.h"
+#include "piecepool.h"
 
 #include <QGraphicsSceneMouseEvent>
 #include <QDebug>
@@ -29,10 +34,6 @@ namespace {
         Empty = 0, Friend = 1, Enemy = 2, InvalidField = 3
     };
 
-    enum class FieldColor : char {
-        White = 'W', Black = 'B'
-    };
-
 
     // offset to middle of piece
     const qreal offsetX{ .5*BoardSizes::FieldWidth };
@@ -70,53 +71,39 @@ namespace {
                          const ChessPiece* plPiece,
                          QGraphicsScene* scene)
     {
+        STATS_COUNT(CheckField);
+
         if(pos.x() < 0 || pos.x() >= BoardSizes::BoardWidth ||
            pos.y() < 0 || pos.y() >= BoardSizes::BoardHeight
         ) {
             return { FieldState::InvalidField };
         }
 
-        // list of elements in middle of field
-        auto list = scene->items({pos.x() + offsetX,
-                                  pos.y() + offsetY});
+        // elements in middle of field, board and highlights are not pieces
+        const auto list = scene->items({pos.x() + offsetX,
+                                        pos.y() + offsetY});
 
-        // make sure at most one piece exist on field
-        Q_ASSERT_X(list.size() <= 2, "TESTcheckField",
-                                     "more than 1 piece at field");
+        ChessPiece* piece{ nullptr };
+        for(QGraphicsItem* item : list) {
+            auto* found = dynamic_cast<ChessPiece*>(item);
+            if(!found) {
+                continue;
+            }
 
-        if(list.size() == 1) { // contains only field
-            return { FieldState::Empty };
+            // make sure at most one piece exist on field
+            Q_ASSERT_X(!piece, "TESTcheckField", "more than 1 piece at field");
+            piece = found;
         }
 
-        auto* piece = dynamic_cast<ChessPiece*>(list.constFirst());
-        if(piece) {
-            if(piece->m_player == plPiece->m_player) {
-                return { FieldState::Friend, piece };
-            }
-            else {
-                return { FieldState::Enemy, piece };
-            }
+        if(!piece) {
+            return { FieldState::Empty };
         }
 
-        return { FieldState::InvalidField };
-    }
-
-    inline FieldColor getFieldColor(QPoint t_pos) {
-        if(t_pos.x() % 2 == 0) {
-            if(t_pos.y() % 2 == 0) {
-                return FieldColor::White;
-            }
-            else {
-                return FieldColor::Black;
-            }
+        if(piece->m_player == plPiece->m_player) {
+            return { FieldState::Friend, piece };
         }
         else {
-            if(t_pos.y() % 2 == 0) {
-                return FieldColor::Black;
-            }
-            else {
-                return FieldColor::White;
-            }
+            return { FieldState::Enemy, piece };
         }
     }
 
@@ -124,6 +111,74 @@ namespace {
         return { pos.x() + offsetX - std::fmod(pos.x() + offsetX, BoardSizes::FieldWidth),
                  pos.y() + offsetY - std::fmod(pos.y() + offsetY, BoardSizes::FieldHeight) };
     }
+
+    // pieces standing on t_ignored already took part in the exchange,
+    // they neither attack nor block lines (x-ray attacks)
+    bool attacksInExchange(const ChessPiece* t_piece,
+                           const QPointF& t_target,
+                           const std::vector<QPointF>& t_ignored)
+    {
+        if(t_piece->m_lastPos == t_target ||
+           contains(t_ignored, t_piece->m_lastPos)
+        ) {
+            return false;
+        }
+
+        return t_piece->canAttackField(t_target, {-1, -1}, t_ignored);
+    }
+
+    const ChessPiece* leastValuableAttacker(Player t_player,
+                                            const QPointF& t_target,
+                                            const std::vector<QPointF>& t_ignored)
+    {
+        const auto& pieces = t_player == Player::White ?
+                                GameStatus::White::pieces :
+                                GameStatus::Black::pieces;
+
+        const ChessPiece* attacker{ nullptr };
+        for(const ChessPiece* piece : pieces) {
+            if((!attacker ||
+                pieceValue(piece->m_type) < pieceValue(attacker->m_type)) &&
+               attacksInExchange(piece, t_target, t_ignored)
+            ) {
+                attacker = piece;
+            }
+        }
+
+        return attacker;
+    }
+
+    // material t_player wins by capturing piece worth t_victimValue on
+    // t_target, t_player may also decide not to capture at all
+    int exchange(const QPointF& t_target,
+                 int t_victimValue,
+                 Player t_player,
+                 std::vector<QPointF>& t_ignored)
+    {
+        const ChessPiece* attacker{
+            leastValuableAttacker(t_player, t_target, t_ignored)
+        };
+        if(!attacker) {
+            return 0;
+        }
+
+        t_ignored.push_back(attacker->m_lastPos);
+
+        const Player enemy{ t_player == Player::White ? Player::Black :
+                                                        Player::White };
+
+        // king cannot capture a defended piece
+        if(attacker->m_type == PieceType::King &&
+           leastValuableAttacker(enemy, t_target, t_ignored)
+        ) {
+            return 0;
+        }
+
+        return std::max(0, t_victimValue - exchange(t_target,
+                                                    pieceValue(attacker->m_type),
+                                                    enemy,
+                                                    t_ignored));
+    }
 }
 
 ChessPiece::ChessPiece(const QPixmap&  t_pixMap,
@@ -142,6 +197,24 @@ ChessPiece::ChessPiece(const QPixmap&  t_pixMap,
     setPos(t_point);
     setFlag(QGraphicsItem::ItemIsMovable);
     setZValue(ChessPiece::defaultZValue);
+
+    // sprites match the view only up to size bucket
+    setTransformationMode(Qt::SmoothTransformation);
+}
+
+void ChessPiece::reset(const QPointF& t_point,
+                       QGraphicsScene* t_scene,
+                       bool t_firstMove)
+{
+    m_lastPos   = t_point;
+    m_scene     = t_scene;
+    m_firstMove = t_firstMove;
+
+    // sprites could be rescaled while piece was pooled
+    setPixmap(Sprites::piece(m_type, m_player));
+    setPos(t_point);
+    setZValue(ChessPiece::defaultZValue);
+    setEnabled(true); // disabled when game ended
 }
 
 ChessPiece* ChessPiece::Create(const QPixmap&  t_pixMap,
@@ -180,63 +253,7 @@ ChessPiece* ChessPiece::Create(PieceType       t_type,
                                QGraphicsScene* t_scene,
                                bool            t_firstMove) noexcept
 {
-    auto t_pixMap = [&]() -> QPixmap {
-            switch (t_type) {
-                case PieceType::Pawn: {
-                    if(t_player == Player::White) {
-                        return {Paths::White::pawn};
-                    }
-                    else {
-                        return {Paths::Black::pawn};
-                    }
-                }
-
-                case PieceType::Knight: {
-                    if(t_player == Player::White) {
-                        return {Paths::White::knight};
-                    }
-                    else {
-                        return {Paths::Black::knight};
-                    }
-                }
-
-                case PieceType::Bishop: {
-                    if(t_player == Player::White) {
-                        return {Paths::White::bishop};
-                    }
-                    else {
-                        return {Paths::Black::bishop};
-                    }
-                }
-
-                case PieceType::Rook: {
-                    if(t_player == Player::White) {
-                        return {Paths::White::rook};
-                    }
-                    else {
-                        return {Paths::Black::rook};
-                    }
-                }
-
-                case PieceType::Queen: {
-                    if(t_player == Player::White) {
-                        return {Paths::White::queen};
-                    }
-                    else {
-                        return {Paths::Black::queen};
-                    }
-                }
-
-                case PieceType::King: {
-                    if(t_player == Player::White) {
-                        return {Paths::White::king};
-                    }
-                    else {
-                        return {Paths::Black::king};
-                    }
-                }
-            }
-    }();
+    const QPixmap& t_pixMap = Sprites::piece(t_type, t_player);
 
     switch (t_type) {
         case PieceType::Pawn:
@@ -262,6 +279,8 @@ ChessPiece* ChessPiece::Create(PieceType       t_type,
 }
 
 void ChessPiece::mousePressEvent(QGraphicsSceneMouseEvent* t_event) {
+    TRACE_SCOPE("mousePressEvent");
+
     if(t_event->button() == Qt::LeftButton) {
         if(GameStatus::currentPlayer != m_player) {
             t_event->ignore();
@@ -269,9 +288,29 @@ void ChessPiece::mousePressEvent(QGraphicsSceneMouseEvent* t_event) {
         else {
             setZValue(zValue() + 1);
 
-            findValidMoves();
+            {
+                TRACE_SCOPE("findValidMoves");
+                STATS_TIME(FindValidMoves);
+                STATS_COUNT(FindValidMoves);
+                ALLOC_SCOPE(FindValidMoves);
 
-            highlight();
+                const size_t generated = findValidMoves();
+                STATS_ADD(GeneratedMoves, generated);
+                ALLOC_UNITS(FindValidMoves, generated);
+            }
+
+            {
+                TRACE_SCOPE("evaluateExchange");
+                for(const auto& move : m_moves) {
+                    move->evaluateExchange();
+                }
+            }
+
+            {
+                TRACE_SCOPE("highlight");
+                STATS_TIME(Highlight);
+                highlight();
+            }
         }
     }
 
@@ -279,6 +318,8 @@ void ChessPiece::mousePressEvent(QGraphicsSceneMouseEvent* t_event) {
 }
 
 void ChessPiece::mouseReleaseEvent(QGraphicsSceneMouseEvent* t_event) {
+    TRACE_SCOPE("mouseReleaseEvent");
+
     if(t_event->button() == Qt::LeftButton) {
         dehighlight();
         setZValue(zValue() - 1);
@@ -299,13 +340,27 @@ void ChessPiece::mouseReleaseEvent(QGraphicsSceneMouseEvent* t_event) {
             // prevents next clicked piece from jumping
             // to top-left corner after promotion
             auto moveType = (*move)->m_type;
-            if(moveType == MoveType::PromotionAttack ||
-               moveType == MoveType::PromotionMove
-            ) {
+            const bool promotion{ moveType == MoveType::PromotionAttack ||
+                                  moveType == MoveType::PromotionMove };
+            if(promotion) {
                 QGraphicsPixmapItem::mouseReleaseEvent(t_event);
             }
 
-            (*move)->exec(); // if promotion - pawn gets deleted
+            {
+                TRACE_SCOPE("Movement::exec");
+                STATS_TIME(MoveExec);
+                STATS_COUNT(MovesMade);
+                if(promotion) {
+                    // modal dialog allocates, promotions are not accounted;
+                    // pawn leaves the scene and pieces, but is only released
+                    // to PiecePool, so this stays valid until the end of the event
+                    (*move)->exec();
+                }
+                else {
+                    ALLOC_SCOPE(MoveExec);
+                    (*move)->exec();
+                }
+            }
 
             auto status = isGameOver();
             if(status.first != WinCondition::Continue) {
@@ -314,6 +369,8 @@ void ChessPiece::mouseReleaseEvent(QGraphicsSceneMouseEvent* t_event) {
             else {
                 ChessPiece::nextTurn();
             }
+
+            STATS_REPORT();
         }
         else {
             t_event->ignore();
@@ -327,41 +384,35 @@ void ChessPiece::mouseReleaseEvent(QGraphicsSceneMouseEvent* t_event) {
 }
 
 void ChessPiece::highlight() {
+    Highlights highlights;
     for(const auto& move : m_moves) {
-        auto list = m_scene->items({move->m_coordinates.x() + offsetX,
-                                    move->m_coordinates.y() + offsetY});
-
-        auto* field = static_cast<QGraphicsRectItem*>(list.last());
-
-        GameStatus::highlighted.emplace(field, field->brush());
-        field->setBrush(move->getHightlightColor());
+        highlights.add(move->m_coordinates, move->getHightlightColor());
     }
+
+    GameStatus::board->setHighlights(highlights);
 }
 
 void ChessPiece::dehighlight() {
-    while (!GameStatus::highlighted.empty()) {
-        auto pair = GameStatus::highlighted.front();
-
-        pair.first->setBrush(pair.second);
+    TRACE_SCOPE("dehighlight");
 
-        GameStatus::highlighted.pop();
-    }
+    GameStatus::board->clearHighlights();
 }
 
 std::pair<WinCondition, Player> ChessPiece::isGameOver() const noexcept {
+    TRACE_SCOPE("isGameOver");
+    STATS_TIME(IsGameOver);
+    STATS_COUNT(IsGameOver);
+    ALLOC_SCOPE(IsGameOver);
+
     if(GameStatus::uselessMoves >= 100) {
         return { WinCondition::FiftyMoves, m_player };
     }
 
+    const Container& friendlyPieces = m_player == Player::White ?
+                                          GameStatus::White::pieces :
+                                          GameStatus::Black::pieces;
+
     // functors for better readability
-    const auto& friendlyPieces = [&] {
-        if(m_player == Player::White) {
-            return GameStatus::White::pieces;
-        }
-        else {
-            return GameStatus::Black::pieces;
-        }
-    }();
 
     const auto& enemyKing = [&] {
         if(m_player == Player::White) {
@@ -412,96 +463,8 @@ std::pair<WinCondition, Player> ChessPiece::isGameOver() const noexcept {
         }
     }
 
-    auto draw = [&]() {
-        // draw conditions:
-        // case       one side(friend)         other side(enemy)
-        //  1           king                       king
-        //
-        //  2       king + knight                  king
-        //
-        //  3       king + n * bishop              king
-        //         n > 0 if bishops
-        //      have the same field color
-        //
-        //  4       king + n * bishop          king + m * bishop
-        //         n > 0 if bishops           m > 0 if bishops
-        //      have the same field color   have the same field color
-        //
-        // cases 1, 2
-        if(m_enemyPieces.size() == 1) { // only king
-            // case 1
-            if(friendlyPieces.size() == 1) { // only king
-                return true;
-            }
-            // case 2
-            else if(friendlyPieces.size() == 2) {
-                if(friendlyPieces[0]->m_type == PieceType::Knight ||
-                   friendlyPieces[1]->m_type == PieceType::Knight
-                ) {
-                    return true;
-                }
-            }
-        }
-
-        //
-        auto containsOnly = [](const std::vector<ChessPiece*>& vec,
-                                PieceType t_type)
-        {
-            return std::all_of(std::begin(vec),
-                               std::end(vec),
-                               [&](ChessPiece* piece) {
-                                   return piece->m_type == t_type ||
-                                          piece->m_type == PieceType::King;
-                               });
-        };
-
-        auto allHaveSameFieldColor = [](const std::vector<ChessPiece*>& vec) {
-            auto firstBishopIT{
-                std::find_if(std::begin(vec),
-                             std::end(vec),
-                             [&](const ChessPiece* piece) {
-                                 return piece->m_type == PieceType::Bishop;
-                             })
-            };
-
-            Q_ASSERT_X(firstBishopIT != std::end(vec),
-                       "isGameOver - draw - containsOnly",
-                       "Couldn't find a piece that should exist");
-
-            FieldColor color {
-                getFieldColor((*firstBishopIT)->m_lastPos.toPoint())
-            };
-
-            return
-            std::all_of(
-                std::begin(vec),
-                std::end(vec),
-                [&](const ChessPiece* piece) {
-                    return piece->m_type == PieceType::King ||
-                        getFieldColor(piece->m_lastPos.toPoint()) == color;
-                });
-        };
-        //
-
-        // cases 3, 4
-        if(containsOnly(friendlyPieces, PieceType::Bishop) &&
-           allHaveSameFieldColor(friendlyPieces)
-        ) {
-            // case 3
-            if(m_enemyPieces.size() == 1) { // only king
-                return true;
-            }
-            // case 4
-            if(containsOnly(m_enemyPieces, PieceType::Bishop) &&
-               allHaveSameFieldColor(m_enemyPieces)
-            ) {
-                return true;
-            }
-        }
-
-        return false;
-    };
-    if(draw()) {
+    // draw when neither side is able to checkmate
+    if(GameStatus::material.insufficientMaterial()) {
         return { WinCondition::Draw, m_player }; // player ignored
     }
 
@@ -530,6 +493,38 @@ void ChessPiece::nextTurn() noexcept {
     }
 }
 
+size_t ChessPiece::findValidMoves() noexcept {
+    return findValidMoves(MoveGenType::All);
+}
+
+int ChessPiece::staticExchange(const ChessPiece* t_attacker,
+                               const ChessPiece* t_victim) noexcept
+{
+    return staticExchange(t_attacker, t_victim, t_victim->m_lastPos);
+}
+
+int ChessPiece::staticExchange(const ChessPiece* t_attacker,
+                               const ChessPiece* t_victim,
+                               const QPointF& t_dest) noexcept
+{
+    // captured piece is gone, even if it did not stand on t_dest
+    std::vector<QPointF> ignored{ t_attacker->m_lastPos, t_victim->m_lastPos };
+
+    return pieceValue(t_victim->m_type) - exchange(t_dest,
+                                                   pieceValue(t_attacker->m_type),
+                                                   t_victim->m_player,
+                                                   ignored);
+}
+
+int ChessPiece::exchangeAfterMove(const QPointF& t_dest) const noexcept {
+    std::vector<QPointF> ignored{ m_lastPos };
+
+    const Player enemy{ m_player == Player::White ? Player::Black :
+                                                    Player::White };
+
+    return -exchange(t_dest, pieceValue(m_type), enemy, ignored);
+}
+
 std::vector<std::unique_ptr<Movement>> ChessPiece::m_moves;
 
 inline void ChessPiece::addMove(Movement* t_move) {
@@ -552,37 +547,32 @@ Pawn::Pawn(const QPixmap&  t_pixMap,
 {
 }
 
+void Pawn::reset(const QPointF& t_point,
+                 QGraphicsScene* t_scene,
+                 bool t_firstMove)
+{
+    ChessPiece::reset(t_point, t_scene, t_firstMove);
+    m_enPassant = false;
+}
+
+template<Player P>
 bool Pawn::canAttackField(const QPointF& t_targetPos,
-                          const QPointF& t_newDefenderPos,
-                          const QPointF& t_ignoredPos) const
+                          const QPointF& t_newDefenderPos) const noexcept
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
 
-    // pawn cannot be blocked, parameters ignored
-    auto posToCheck = [&] () -> std::array<const QPointF, 2> {
-        if(m_player == Player::White) {
-            return {{
-                // right top
-                {m_lastPos.x() + BoardSizes::FieldWidth,
-                 m_lastPos.y() - BoardSizes::FieldHeight},
-                // left top
-                {m_lastPos.x() - BoardSizes::FieldWidth,
-                 m_lastPos.y() - BoardSizes::FieldHeight}
-            }};
-        }
-        else {
-            return {{
-                // right bottom
-                {m_lastPos.x() + BoardSizes::FieldWidth,
-                 m_lastPos.y() + BoardSizes::FieldHeight},
-                // left bottom
-                {m_lastPos.x() - BoardSizes::FieldWidth,
-                 m_lastPos.y() + BoardSizes::FieldHeight}
-            }};
-        }
-    }();
+    constexpr const qreal direction = PlayerTraits<P>::pawnDirection;
+
+    const std::array<QPointF, 2> posToCheck{{
+        // right
+        {m_lastPos.x() + BoardSizes::FieldWidth, m_lastPos.y() + direction},
+        // left
+        {m_lastPos.x() - BoardSizes::FieldWidth, m_lastPos.y() + direction}
+    }};
 
     for(const auto& pos : posToCheck) {
         auto state = checkField(pos, this, m_scene);
@@ -600,53 +590,30 @@ bool Pawn::canAttackField(const QPointF& t_targetPos,
 
 bool Pawn::canAttackField(const QPointF& t_targetPos,
                           const QPointF& t_newDefenderPos,
-                          std::vector<QPointF>&& t_ignoredPos) const
+                          const QPointF& /*t_ignoredPos*/) const
 {
-    if(m_lastPos == t_newDefenderPos) {
-        return false;
-    }
-
-    // pawn cannot be blocked, parameters ignored
-    auto posToCheck = [&] () -> std::array<QPointF, 2> {
-        if(m_player == Player::White) {
-            return {{
-                // right top
-                {m_lastPos.x() + BoardSizes::FieldWidth,
-                 m_lastPos.y() - BoardSizes::FieldHeight},
-                // left top
-                {m_lastPos.x() - BoardSizes::FieldWidth,
-                 m_lastPos.y() - BoardSizes::FieldHeight}
-            }};
-        }
-        else {
-            return {{
-                // right bottom
-                {m_lastPos.x() + BoardSizes::FieldWidth,
-                 m_lastPos.y() + BoardSizes::FieldHeight},
-                // left bottom
-                {m_lastPos.x() - BoardSizes::FieldWidth,
-                 m_lastPos.y() + BoardSizes::FieldHeight}
-            }};
-        }
-    }();
-
-    for(const auto& pos : posToCheck) {
-        auto state = checkField(pos, this, m_scene);
-
-        if(pos == t_targetPos ||
-           (state == FieldState::Enemy &&
-            state.piece->m_lastPos == t_targetPos))
-        {
-            return true;
-        }
-    }
+    // pawn cannot be blocked, ignored positions not needed
+    return m_player == Player::White ?
+                canAttackField<Player::White>(t_targetPos, t_newDefenderPos) :
+                canAttackField<Player::Black>(t_targetPos, t_newDefenderPos);
+}
 
-    return false;
+bool Pawn::canAttackField(const QPointF& t_targetPos,
+                          const QPointF& t_newDefenderPos,
+                          const std::vector<QPointF>& /*t_ignoredPos*/) const
+{
+    // pawn cannot be blocked, ignored positions not needed
+    return m_player == Player::White ?
+                canAttackField<Player::White>(t_targetPos, t_newDefenderPos) :
+                canAttackField<Player::Black>(t_targetPos, t_newDefenderPos);
 }
 
+template<Player P>
 bool Pawn::haveValidMoves() const noexcept {
-    const auto direction = m_player == Player::White ? -BoardSizes::FieldHeight :
-                                                        BoardSizes::FieldHeight;
+    constexpr const qreal direction = PlayerTraits<P>::pawnDirection;
+
+    const King* king{ PlayerTraits<P>::king() };
+    const Container& enemyPieces{ PlayerTraits<P>::enemyPieces() };
 
     // middle, move only
     {
@@ -654,18 +621,28 @@ bool Pawn::haveValidMoves() const noexcept {
         auto state = checkField(middle, this, m_scene);
 
         if(state == FieldState::Empty &&
-           std::none_of(std::begin(m_enemyPieces),
-                        std::end(m_enemyPieces),
+           std::none_of(std::begin(enemyPieces),
+                        std::end(enemyPieces),
                         [&](const ChessPiece* enemy) {
                             if(enemy->m_lastPos == middle)
                                 return true;
-                            return enemy->canAttackField(m_king->m_lastPos,
+                            return enemy->canAttackField(king->m_lastPos,
                                                          middle,
                                                          m_lastPos);
                         })
         ) {
             return true;
         }
+
+        // second middle, can block a check the first one does not
+        const QPointF secondMiddle{m_lastPos.x(), m_lastPos.y() + 2*direction};
+        if(state == FieldState::Empty &&
+           m_firstMove &&
+           checkField(secondMiddle, this, m_scene) == FieldState::Empty &&
+           !king->inCheckAfterMove<P>(secondMiddle, m_lastPos)
+        ) {
+            return true;
+        }
     }
 
     // ordinary attack
@@ -679,7 +656,7 @@ bool Pawn::haveValidMoves() const noexcept {
             auto state = checkField(point, this, m_scene);
 
             if(state == FieldState::Enemy &&
-               !m_king->inCheckAfterMove(point, m_lastPos)
+               !king->inCheckAfterMove<P>(point, m_lastPos)
             ) {
                 return true;
             }
@@ -707,7 +684,7 @@ bool Pawn::haveValidMoves() const noexcept {
                attackedPosStatus == FieldState::Enemy &&
                attackedPosStatus.piece->m_type == PieceType::Pawn &&
                static_cast<Pawn*>(attackedPosStatus.piece)->m_enPassant &&
-               !m_king->inCheckAfterMove(points[1], {m_lastPos, points[0]})
+               !king->inCheckAfterMove<P>(points[1], {m_lastPos, points[0]})
             ) {
                 return true;
             }
@@ -717,31 +694,38 @@ bool Pawn::haveValidMoves() const noexcept {
     return false;
 }
 
-size_t Pawn::findValidMoves() noexcept {
-    const qreal direction = m_player == Player::White ? -BoardSizes::FieldHeight :
-                                                        BoardSizes::FieldHeight;
+bool Pawn::haveValidMoves() const noexcept {
+    STATS_COUNT(HaveValidMoves);
+
+    return m_player == Player::White ? haveValidMoves<Player::White>() :
+                                       haveValidMoves<Player::Black>();
+}
+
+template<Player P>
+size_t Pawn::findValidMoves(MoveGenType t_genType) noexcept {
+    constexpr const qreal direction = PlayerTraits<P>::pawnDirection;
+
+    const King* king{ PlayerTraits<P>::king() };
 
     // middle, move only
-    {
+    if(generatesQuiets(t_genType)) {
         const QPointF middle { m_lastPos.x(), m_lastPos.y() + direction },
                 secondMiddle { m_lastPos.x(), m_lastPos.y() + 2*direction };
-        if(checkField(middle, this, m_scene) == FieldState::Empty &&
-           !m_king->inCheckAfterMove(middle, m_lastPos)
-        ) {
-            // if last field, save as promotion
-            if(middle.y() <  BoardSizes::FieldHeight ||
-               middle.y() >= BoardSizes::BoardHeight - BoardSizes::FieldHeight
-            ) {
-                addMove(new PromotionMove(this, middle));
-            }
-            else {
-                addMove(new Move(this, middle));
+        if(checkField(middle, this, m_scene) == FieldState::Empty) {
+            if(!king->inCheckAfterMove<P>(middle, m_lastPos)) {
+                // if last field, save as promotion
+                if(PlayerTraits<P>::isLastRow(middle.y())) {
+                    addMove(new PromotionMove(this, middle));
+                }
+                else {
+                    addMove(new Move(this, middle));
+                }
             }
 
-            // second middle, move only
+            // second middle, move only, may block a check the first one does not
             if(m_firstMove &&
                checkField(secondMiddle, this, m_scene) == FieldState::Empty &&
-               !m_king->inCheckAfterMove(secondMiddle, m_lastPos)
+               !king->inCheckAfterMove<P>(secondMiddle, m_lastPos)
             ) {
                 addMove(new EnPassantMove(this, secondMiddle));
             }
@@ -749,7 +733,7 @@ size_t Pawn::findValidMoves() noexcept {
     }
 
     // ordinary attack
-    {
+    if(generatesCaptures(t_genType)) {
         const std::array<QPointF, 2> ordinaryAttack{{
             {m_lastPos.x() - BoardSizes::FieldWidth, m_lastPos.y() + direction}, // left
             {m_lastPos.x() + BoardSizes::FieldWidth, m_lastPos.y() + direction}  // right
@@ -759,11 +743,9 @@ size_t Pawn::findValidMoves() noexcept {
             auto state = checkField(point, this, m_scene);
 
             if(state == FieldState::Enemy &&
-               !m_king->inCheckAfterMove(point, m_lastPos)
+               !king->inCheckAfterMove<P>(point, m_lastPos)
             ) {
-                if(point.y() <  BoardSizes::FieldHeight ||
-                   point.y() >= BoardSizes::BoardHeight - BoardSizes::FieldHeight
-                ) {
+                if(PlayerTraits<P>::isLastRow(point.y())) {
                     addMove(new PromotionAttack(this, state.piece));
                 }
                 else {
@@ -774,7 +756,7 @@ size_t Pawn::findValidMoves() noexcept {
     }
 
     // en passant
-    {
+    if(generatesCaptures(t_genType)) {
         const std::array<std::array<QPointF, 2>, 2> epMoves{{
             {{
                 {m_lastPos.x() - BoardSizes::FieldWidth, m_lastPos.y()}, // left ep attack
@@ -794,7 +776,7 @@ size_t Pawn::findValidMoves() noexcept {
                attackedPosStatus == FieldState::Enemy &&
                attackedPosStatus.piece->m_type == PieceType::Pawn &&
                static_cast<Pawn*>(attackedPosStatus.piece)->m_enPassant &&
-               !m_king->inCheckAfterMove(points[1], {m_lastPos, points[0]})
+               !king->inCheckAfterMove<P>(points[1], {m_lastPos, points[0]})
             ) {
                 addMove(new EnPassantAttack(this, attackedPosStatus.piece, points[1]));
             }
@@ -804,6 +786,11 @@ size_t Pawn::findValidMoves() noexcept {
     return m_moves.size();
 }
 
+size_t Pawn::findValidMoves(MoveGenType t_genType) noexcept {
+    return m_player == Player::White ? findValidMoves<Player::White>(t_genType) :
+                                       findValidMoves<Player::Black>(t_genType);
+}
+
 void Pawn::promote() {
     auto type = [&]() -> PieceType {
         PromotionDialog dialog(this);
@@ -811,21 +798,21 @@ void Pawn::promote() {
         return dialog.getType();
     }();
 
-    // delete piece from scene and container
-    // add piece to scene and container
+    // replace pawn with new piece in scene and container
 
-    auto newPiece = ChessPiece::Create(type, m_lastPos, m_player, m_scene, false);
+    auto newPiece = PiecePool::acquire(type, m_lastPos, m_player, m_scene, false);
 
     auto& pieces = m_player == Player::White ? GameStatus::White::pieces:
                                                GameStatus::Black::pieces;
 
     pieces.erase(std::find(std::begin(pieces), std::end(pieces), this));
 
-    // scene no longer owns this piece
-    GameStatus::promotedPieces.emplace_back(this);
-    m_scene->removeItem(this);
+    GameStatus::material.remove(m_type, m_player, m_lastPos);
+    GameStatus::material.add(type, m_player, m_lastPos);
 
+    // still handling its mouse event, so pawn is only removed from scene
     m_scene->addItem(newPiece);
+    PiecePool::release(this);
     pieces.push_back(newPiece);
 }
 
@@ -849,6 +836,8 @@ bool Knight::canAttackField(const QPointF& t_targetPos,
                             const QPointF& t_newDefenderPos,
                             const QPointF& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -884,27 +873,17 @@ bool Knight::canAttackField(const QPointF& t_targetPos,
              m_lastPos.y() + BoardSizes::FieldHeight}
     }};
 
-    for(const auto& pos : posToCheck) {
-        if(pos != t_targetPos) {
-            continue;
-        }
-
-        auto state = checkField(pos, this, m_scene);
-
-        if(state == FieldState::Enemy ||
-           state == FieldState::Empty
-        ) {
-            return true;
-        }
-    }
-
-    return false;
+    // friendly piece on target is defended as well
+    return std::find(std::begin(posToCheck), std::end(posToCheck), t_targetPos) !=
+           std::end(posToCheck);
 }
 
 bool Knight::canAttackField(const QPointF& t_targetPos,
                             const QPointF& t_newDefenderPos,
-                            std::vector<QPointF>&& t_ignoredPos) const
+                            const std::vector<QPointF>& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -940,24 +919,15 @@ bool Knight::canAttackField(const QPointF& t_targetPos,
              m_lastPos.y() + BoardSizes::FieldHeight}
     }};
 
-    for(const auto& pos : posToCheck) {
-        if(pos != t_targetPos) {
-            continue;
-        }
-
-        auto state = checkField(pos, this, m_scene);
-
-        if(state == FieldState::Enemy ||
-           state == FieldState::Empty
-        ) {
-            return true;
-        }
-    }
-
-    return false;
+    // friendly piece on target is defended as well
+    return std::find(std::begin(posToCheck), std::end(posToCheck), t_targetPos) !=
+           std::end(posToCheck);
 }
 
+template<Player P>
 bool Knight::haveValidMoves() const noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     const std::array<QPointF, 8> posToCheck{{
             // top left
             {m_lastPos.x() - BoardSizes::FieldWidth,
@@ -997,7 +967,7 @@ bool Knight::haveValidMoves() const noexcept {
             continue;
         }
 
-        if(!m_king->inCheckAfterMove(pos, m_lastPos)) {
+        if(!king->inCheckAfterMove<P>(pos, m_lastPos)) {
             return true;
         }
     }
@@ -1005,7 +975,17 @@ bool Knight::haveValidMoves() const noexcept {
     return false;
 }
 
-size_t Knight::findValidMoves() noexcept {
+bool Knight::haveValidMoves() const noexcept {
+    STATS_COUNT(HaveValidMoves);
+
+    return m_player == Player::White ? haveValidMoves<Player::White>() :
+                                       haveValidMoves<Player::Black>();
+}
+
+template<Player P>
+size_t Knight::findValidMoves(MoveGenType t_genType) noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     const std::array<QPointF, 8> posToCheck{{
             // top left
             {m_lastPos.x() - BoardSizes::FieldWidth,
@@ -1045,7 +1025,13 @@ size_t Knight::findValidMoves() noexcept {
             continue;
         }
 
-        if(!m_king->inCheckAfterMove(pos, m_lastPos)) {
+        if((state == FieldState::Enemy && !generatesCaptures(t_genType)) ||
+           (state == FieldState::Empty && !generatesQuiets(t_genType))
+        ) {
+            continue;
+        }
+
+        if(!king->inCheckAfterMove<P>(pos, m_lastPos)) {
             if(state == FieldState::Enemy) {
                 addMove(new Attack(this, state.piece));
             }
@@ -1058,6 +1044,11 @@ size_t Knight::findValidMoves() noexcept {
     return m_moves.size();
 }
 
+size_t Knight::findValidMoves(MoveGenType t_genType) noexcept {
+    return m_player == Player::White ? findValidMoves<Player::White>(t_genType) :
+                                       findValidMoves<Player::Black>(t_genType);
+}
+
 //
 
 Bishop::Bishop(const QPixmap&  t_pixMap,
@@ -1078,6 +1069,8 @@ bool Bishop::canAttackField(const QPointF& t_targetPos,
                             const QPointF& t_newDefenderPos,
                             const QPointF& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -1187,8 +1180,10 @@ bool Bishop::canAttackField(const QPointF& t_targetPos,
 
 bool Bishop::canAttackField(const QPointF& t_targetPos,
                             const QPointF& t_newDefenderPos,
-                            std::vector<QPointF>&& t_ignoredPos) const
+                            const std::vector<QPointF>& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -1296,7 +1291,10 @@ bool Bishop::canAttackField(const QPointF& t_targetPos,
     return false;
 }
 
+template<Player P>
 bool Bishop::haveValidMoves() const noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     // left top diagonal
     {
         QPointF leftTopDiagonal{m_lastPos.x() - BoardSizes::FieldWidth,
@@ -1305,10 +1303,22 @@ bool Bishop::haveValidMoves() const noexcept {
         while(leftTopDiagonal.x() >= 0 &&
               leftTopDiagonal.y() >= 0
         ) {
-            if(!m_king->inCheckAfterMove(leftTopDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(leftTopDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(leftTopDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             leftTopDiagonal.rx() -= BoardSizes::FieldWidth;
             leftTopDiagonal.ry() -= BoardSizes::FieldHeight;
         }
@@ -1321,10 +1331,22 @@ bool Bishop::haveValidMoves() const noexcept {
         while(rightBottomDiagonal.x() < BoardSizes::BoardWidth &&
               rightBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!m_king->inCheckAfterMove(rightBottomDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(rightBottomDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(rightBottomDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             rightBottomDiagonal.rx() += BoardSizes::FieldWidth;
             rightBottomDiagonal.ry() += BoardSizes::FieldHeight;
         }
@@ -1337,10 +1359,22 @@ bool Bishop::haveValidMoves() const noexcept {
         while(rightTopDiagonal.x() < BoardSizes::BoardWidth &&
               rightTopDiagonal.y() >= 0
         ) {
-            if(!m_king->inCheckAfterMove(rightTopDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(rightTopDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(rightTopDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             rightTopDiagonal.rx() += BoardSizes::FieldWidth;
             rightTopDiagonal.ry() -= BoardSizes::FieldHeight;
         }
@@ -1353,10 +1387,22 @@ bool Bishop::haveValidMoves() const noexcept {
         while(leftBottomDiagonal.x() >= 0 &&
               leftBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!m_king->inCheckAfterMove(leftBottomDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(leftBottomDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(leftBottomDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             leftBottomDiagonal.rx() -= BoardSizes::FieldWidth;
             leftBottomDiagonal.ry() += BoardSizes::FieldHeight;
         }
@@ -1365,7 +1411,15 @@ bool Bishop::haveValidMoves() const noexcept {
     return false;
 }
 
-size_t Bishop::findValidMoves() noexcept {
+bool Bishop::haveValidMoves() const noexcept {
+    STATS_COUNT(HaveValidMoves);
+
+    return m_player == Player::White ? haveValidMoves<Player::White>() :
+                                       haveValidMoves<Player::Black>();
+}
+
+template<Player P>
+size_t Bishop::findValidMoves(MoveGenType t_genType) noexcept {
     // left top diagonal
     {
         QPointF leftTopDiagonal{m_lastPos.x() - BoardSizes::FieldWidth,
@@ -1374,7 +1428,7 @@ size_t Bishop::findValidMoves() noexcept {
         while(leftTopDiagonal.x() >= 0 &&
               leftTopDiagonal.y() >= 0
         ) {
-            if(!validateField(leftTopDiagonal)) {
+            if(!validateField<P>(leftTopDiagonal, t_genType)) {
                 break;
             }
 
@@ -1390,7 +1444,7 @@ size_t Bishop::findValidMoves() noexcept {
         while(rightBottomDiagonal.x() < BoardSizes::BoardWidth &&
               rightBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!validateField(rightBottomDiagonal)) {
+            if(!validateField<P>(rightBottomDiagonal, t_genType)) {
                 break;
             }
 
@@ -1406,7 +1460,7 @@ size_t Bishop::findValidMoves() noexcept {
         while(rightTopDiagonal.x() < BoardSizes::BoardWidth &&
               rightTopDiagonal.y() >= 0
         ) {
-            if(!validateField(rightTopDiagonal)) {
+            if(!validateField<P>(rightTopDiagonal, t_genType)) {
                 break;
             }
 
@@ -1422,7 +1476,7 @@ size_t Bishop::findValidMoves() noexcept {
         while(leftBottomDiagonal.x() >= 0 &&
               leftBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!validateField(leftBottomDiagonal)) {
+            if(!validateField<P>(leftBottomDiagonal, t_genType)) {
                 break;
             }
 
@@ -1434,7 +1488,16 @@ size_t Bishop::findValidMoves() noexcept {
     return m_moves.size();
 }
 
-bool Bishop::validateField(const QPointF& t_field) noexcept {
+size_t Bishop::findValidMoves(MoveGenType t_genType) noexcept {
+    return m_player == Player::White ? findValidMoves<Player::White>(t_genType) :
+                                       findValidMoves<Player::Black>(t_genType);
+}
+
+template<Player P>
+bool Bishop::validateField(const QPointF& t_field,
+                           MoveGenType t_genType) noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     auto state = checkField(t_field, this, m_scene);
 
     if(state == FieldState::Friend ||
@@ -1443,14 +1506,21 @@ bool Bishop::validateField(const QPointF& t_field) noexcept {
         return false;
     }
 
-    if(!m_king->inCheckAfterMove(t_field, m_lastPos)) {
-        if(state == FieldState::Enemy) {
+    // enemy blocks the path whether or not it can be captured
+    if(state == FieldState::Enemy) {
+        if(generatesCaptures(t_genType) &&
+           !king->inCheckAfterMove<P>(t_field, m_lastPos)
+        ) {
             addMove(new Attack(this, state.piece));
-            return false;
-        }
-        else if (state == FieldState::Empty) {
-            addMove(new Move(this, t_field));
         }
+        return false;
+    }
+
+    // empty field, check is expensive so skip it if quiets are not needed
+    if(generatesQuiets(t_genType) &&
+       !king->inCheckAfterMove<P>(t_field, m_lastPos)
+    ) {
+        addMove(new Move(this, t_field));
     }
 
     return true;
@@ -1476,6 +1546,8 @@ bool Rook::canAttackField(const QPointF& t_targetPos,
                           const QPointF& t_newDefenderPos,
                           const QPointF& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -1566,8 +1638,10 @@ bool Rook::canAttackField(const QPointF& t_targetPos,
 
 bool Rook::canAttackField(const QPointF& t_targetPos,
                           const QPointF& t_newDefenderPos,
-                          std::vector<QPointF>&& t_ignoredPos) const
+                          const std::vector<QPointF>& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -1596,7 +1670,7 @@ bool Rook::canAttackField(const QPointF& t_targetPos,
         }
 
         // bottom
-        else if(t_targetPos.y() < m_lastPos.y()) {
+        else if(t_targetPos.y() > m_lastPos.y()) {
             QPointF bottom{ m_lastPos.x(), m_lastPos.y() + BoardSizes::FieldHeight };
 
             while(bottom.y() < t_targetPos.y()) {
@@ -1656,17 +1730,32 @@ bool Rook::canAttackField(const QPointF& t_targetPos,
     return false;
 }
 
+template<Player P>
 bool Rook::haveValidMoves() const noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     // top straight
     {
         QPointF topStraight{m_lastPos.x(),
                             m_lastPos.y() - BoardSizes::FieldHeight};
 
         while(topStraight.y() >= 0) {
-            if(!m_king->inCheckAfterMove(topStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(topStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(topStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             topStraight.ry() -= BoardSizes::FieldHeight;
         }
     }
@@ -1676,10 +1765,22 @@ bool Rook::haveValidMoves() const noexcept {
                               m_lastPos.y()};
 
         while(rightStraight.x() < BoardSizes::BoardWidth) {
-            if(!m_king->inCheckAfterMove(rightStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(rightStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(rightStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
 
             rightStraight.rx() += BoardSizes::FieldWidth;
         }
@@ -1690,10 +1791,22 @@ bool Rook::haveValidMoves() const noexcept {
                                m_lastPos.y() + BoardSizes::FieldHeight};
 
         while(bottomStraight.y() < BoardSizes::BoardHeight) {
-            if(!m_king->inCheckAfterMove(bottomStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(bottomStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(bottomStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
 
             bottomStraight.ry() += BoardSizes::FieldHeight;
         }
@@ -1704,10 +1817,22 @@ bool Rook::haveValidMoves() const noexcept {
                              m_lastPos.y()};
 
         while(leftStraight.x() >= 0) {
-            if(!m_king->inCheckAfterMove(leftStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(leftStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(leftStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             leftStraight.rx() -= BoardSizes::FieldWidth;
         }
     }
@@ -1715,14 +1840,22 @@ bool Rook::haveValidMoves() const noexcept {
     return false;
 }
 
-size_t Rook::findValidMoves() noexcept {
+bool Rook::haveValidMoves() const noexcept {
+    STATS_COUNT(HaveValidMoves);
+
+    return m_player == Player::White ? haveValidMoves<Player::White>() :
+                                       haveValidMoves<Player::Black>();
+}
+
+template<Player P>
+size_t Rook::findValidMoves(MoveGenType t_genType) noexcept {
     // top straight
     {
         QPointF topStraight{m_lastPos.x(),
                             m_lastPos.y() - BoardSizes::FieldHeight};
 
         while(topStraight.y() >= 0) {
-            if(!validateField(topStraight)) {
+            if(!validateField<P>(topStraight, t_genType)) {
                 break;
             }
 
@@ -1735,7 +1868,7 @@ size_t Rook::findValidMoves() noexcept {
                               m_lastPos.y()};
 
         while(rightStraight.x() < BoardSizes::BoardWidth) {
-            if(!validateField(rightStraight)) {
+            if(!validateField<P>(rightStraight, t_genType)) {
                 break;
             }
 
@@ -1748,7 +1881,7 @@ size_t Rook::findValidMoves() noexcept {
                                m_lastPos.y() + BoardSizes::FieldHeight};
 
         while(bottomStraight.y() < BoardSizes::BoardHeight) {
-            if(!validateField(bottomStraight)) {
+            if(!validateField<P>(bottomStraight, t_genType)) {
                 break;
             }
 
@@ -1761,7 +1894,7 @@ size_t Rook::findValidMoves() noexcept {
                              m_lastPos.y()};
 
         while(leftStraight.x() >= 0) {
-            if(!validateField(leftStraight)) {
+            if(!validateField<P>(leftStraight, t_genType)) {
                 break;
             }
 
@@ -1772,7 +1905,16 @@ size_t Rook::findValidMoves() noexcept {
     return m_moves.size();
 }
 
-bool Rook::validateField(const QPointF& t_field) noexcept {
+size_t Rook::findValidMoves(MoveGenType t_genType) noexcept {
+    return m_player == Player::White ? findValidMoves<Player::White>(t_genType) :
+                                       findValidMoves<Player::Black>(t_genType);
+}
+
+template<Player P>
+bool Rook::validateField(const QPointF& t_field,
+                         MoveGenType t_genType) noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     auto state = checkField(t_field, this, m_scene);
 
     if(state == FieldState::Friend ||
@@ -1781,14 +1923,21 @@ bool Rook::validateField(const QPointF& t_field) noexcept {
         return false;
     }
 
-    if(!m_king->inCheckAfterMove(t_field, m_lastPos)) {
-        if(state == FieldState::Enemy) {
+    // enemy blocks the path whether or not it can be captured
+    if(state == FieldState::Enemy) {
+        if(generatesCaptures(t_genType) &&
+           !king->inCheckAfterMove<P>(t_field, m_lastPos)
+        ) {
             addMove(new Attack(this, state.piece));
-            return false;
-        }
-        else if (state == FieldState::Empty) {
-            addMove(new Move(this, t_field));
         }
+        return false;
+    }
+
+    // empty field, check is expensive so skip it if quiets are not needed
+    if(generatesQuiets(t_genType) &&
+       !king->inCheckAfterMove<P>(t_field, m_lastPos)
+    ) {
+        addMove(new Move(this, t_field));
     }
 
     return true;
@@ -1814,6 +1963,8 @@ bool Queen::canAttackField(const QPointF& t_targetPos,
                            const QPointF& t_newDefenderPos,
                            const QPointF& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -2001,8 +2152,10 @@ bool Queen::canAttackField(const QPointF& t_targetPos,
 
 bool Queen::canAttackField(const QPointF& t_targetPos,
                            const QPointF& t_newDefenderPos,
-                           std::vector<QPointF>&& t_ignoredPos) const
+                           const std::vector<QPointF>& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     if(m_lastPos == t_newDefenderPos) {
         return false;
     }
@@ -2031,7 +2184,7 @@ bool Queen::canAttackField(const QPointF& t_targetPos,
         }
 
         // bottom
-        else if(t_targetPos.y() < m_lastPos.y()) {
+        else if(t_targetPos.y() > m_lastPos.y()) {
             QPointF bottom{ m_lastPos.x(), m_lastPos.y() + BoardSizes::FieldHeight };
 
             while(bottom.y() < t_targetPos.y()) {
@@ -2188,7 +2341,10 @@ bool Queen::canAttackField(const QPointF& t_targetPos,
     return false;
 }
 
+template<Player P>
 bool Queen::haveValidMoves() const noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     // left top diagonal
     {
         QPointF leftTopDiagonal{m_lastPos.x() - BoardSizes::FieldWidth,
@@ -2197,10 +2353,22 @@ bool Queen::haveValidMoves() const noexcept {
         while(leftTopDiagonal.x() >= 0 &&
               leftTopDiagonal.y() >= 0
         ) {
-            if(!m_king->inCheckAfterMove(leftTopDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(leftTopDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(leftTopDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             leftTopDiagonal.rx() -= BoardSizes::FieldWidth;
             leftTopDiagonal.ry() -= BoardSizes::FieldHeight;
         }
@@ -2213,10 +2381,22 @@ bool Queen::haveValidMoves() const noexcept {
         while(rightBottomDiagonal.x() < BoardSizes::BoardWidth &&
               rightBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!m_king->inCheckAfterMove(rightBottomDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(rightBottomDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(rightBottomDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             rightBottomDiagonal.rx() += BoardSizes::FieldWidth;
             rightBottomDiagonal.ry() += BoardSizes::FieldHeight;
         }
@@ -2229,10 +2409,22 @@ bool Queen::haveValidMoves() const noexcept {
         while(rightTopDiagonal.x() < BoardSizes::BoardWidth &&
               rightTopDiagonal.y() >= 0
         ) {
-            if(!m_king->inCheckAfterMove(rightTopDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(rightTopDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(rightTopDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             rightTopDiagonal.rx() += BoardSizes::FieldWidth;
             rightTopDiagonal.ry() -= BoardSizes::FieldHeight;
         }
@@ -2245,10 +2437,22 @@ bool Queen::haveValidMoves() const noexcept {
         while(leftBottomDiagonal.x() >= 0 &&
               leftBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!m_king->inCheckAfterMove(leftBottomDiagonal, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(leftBottomDiagonal, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(leftBottomDiagonal, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             leftBottomDiagonal.rx() -= BoardSizes::FieldWidth;
             leftBottomDiagonal.ry() += BoardSizes::FieldHeight;
         }
@@ -2260,10 +2464,22 @@ bool Queen::haveValidMoves() const noexcept {
                             m_lastPos.y() - BoardSizes::FieldHeight};
 
         while(topStraight.y() >= 0) {
-            if(!m_king->inCheckAfterMove(topStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(topStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(topStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             topStraight.ry() -= BoardSizes::FieldHeight;
         }
     }
@@ -2273,10 +2489,22 @@ bool Queen::haveValidMoves() const noexcept {
                               m_lastPos.y()};
 
         while(rightStraight.x() < BoardSizes::BoardWidth) {
-            if(!m_king->inCheckAfterMove(rightStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(rightStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(rightStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             rightStraight.rx() += BoardSizes::FieldWidth;
         }
     }
@@ -2286,10 +2514,22 @@ bool Queen::haveValidMoves() const noexcept {
                                m_lastPos.y() + BoardSizes::FieldHeight};
 
         while(bottomStraight.y() < BoardSizes::BoardHeight) {
-            if(!m_king->inCheckAfterMove(bottomStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(bottomStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(bottomStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             bottomStraight.ry() += BoardSizes::FieldHeight;
         }
     }
@@ -2299,10 +2539,22 @@ bool Queen::haveValidMoves() const noexcept {
                              m_lastPos.y()};
 
         while(leftStraight.x() >= 0) {
-            if(!m_king->inCheckAfterMove(leftStraight, m_lastPos)) {
+            // blocked by own piece, enemy piece can be taken
+            const auto state = checkField(leftStraight, this, m_scene);
+            if(state == FieldState::Friend ||
+               state == FieldState::InvalidField
+            ) {
+                break;
+            }
+
+            if(!king->inCheckAfterMove<P>(leftStraight, m_lastPos)) {
                 return true;
             }
 
+            if(state == FieldState::Enemy) {
+                break;
+            }
+
             leftStraight.rx() -= BoardSizes::FieldWidth;
         }
     }
@@ -2310,7 +2562,15 @@ bool Queen::haveValidMoves() const noexcept {
     return false;
 }
 
-size_t Queen::findValidMoves() noexcept {
+bool Queen::haveValidMoves() const noexcept {
+    STATS_COUNT(HaveValidMoves);
+
+    return m_player == Player::White ? haveValidMoves<Player::White>() :
+                                       haveValidMoves<Player::Black>();
+}
+
+template<Player P>
+size_t Queen::findValidMoves(MoveGenType t_genType) noexcept {
     // left top diagonal
     {
         QPointF leftTopDiagonal{m_lastPos.x() - BoardSizes::FieldWidth,
@@ -2319,7 +2579,7 @@ size_t Queen::findValidMoves() noexcept {
         while(leftTopDiagonal.x() >= 0 &&
               leftTopDiagonal.y() >= 0
         ) {
-            if(!validateField(leftTopDiagonal)) {
+            if(!validateField<P>(leftTopDiagonal, t_genType)) {
                 break;
             }
 
@@ -2335,7 +2595,7 @@ size_t Queen::findValidMoves() noexcept {
         while(rightBottomDiagonal.x() < BoardSizes::BoardWidth &&
               rightBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!validateField(rightBottomDiagonal)) {
+            if(!validateField<P>(rightBottomDiagonal, t_genType)) {
                 break;
             }
 
@@ -2351,7 +2611,7 @@ size_t Queen::findValidMoves() noexcept {
         while(rightTopDiagonal.x() < BoardSizes::BoardWidth &&
               rightTopDiagonal.y() >= 0
         ) {
-            if(!validateField(rightTopDiagonal)) {
+            if(!validateField<P>(rightTopDiagonal, t_genType)) {
                 break;
             }
 
@@ -2367,7 +2627,7 @@ size_t Queen::findValidMoves() noexcept {
         while(leftBottomDiagonal.x() >= 0 &&
               leftBottomDiagonal.y() < BoardSizes::BoardHeight
         ) {
-            if(!validateField(leftBottomDiagonal)) {
+            if(!validateField<P>(leftBottomDiagonal, t_genType)) {
                 break;
             }
 
@@ -2382,7 +2642,7 @@ size_t Queen::findValidMoves() noexcept {
                             m_lastPos.y() - BoardSizes::FieldHeight};
 
         while(topStraight.y() >= 0) {
-            if(!validateField(topStraight)) {
+            if(!validateField<P>(topStraight, t_genType)) {
                 break;
             }
 
@@ -2395,7 +2655,7 @@ size_t Queen::findValidMoves() noexcept {
                               m_lastPos.y()};
 
         while(rightStraight.x() < BoardSizes::BoardWidth) {
-            if(!validateField(rightStraight)) {
+            if(!validateField<P>(rightStraight, t_genType)) {
                 break;
             }
 
@@ -2408,7 +2668,7 @@ size_t Queen::findValidMoves() noexcept {
                                m_lastPos.y() + BoardSizes::FieldHeight};
 
         while(bottomStraight.y() < BoardSizes::BoardHeight) {
-            if(!validateField(bottomStraight)) {
+            if(!validateField<P>(bottomStraight, t_genType)) {
                 break;
             }
 
@@ -2421,7 +2681,7 @@ size_t Queen::findValidMoves() noexcept {
                              m_lastPos.y()};
 
         while(leftStraight.x() >= 0) {
-            if(!validateField(leftStraight)) {
+            if(!validateField<P>(leftStraight, t_genType)) {
                 break;
             }
 
@@ -2432,7 +2692,16 @@ size_t Queen::findValidMoves() noexcept {
     return m_moves.size();
 }
 
-bool Queen::validateField(const QPointF& t_field) noexcept {
+size_t Queen::findValidMoves(MoveGenType t_genType) noexcept {
+    return m_player == Player::White ? findValidMoves<Player::White>(t_genType) :
+                                       findValidMoves<Player::Black>(t_genType);
+}
+
+template<Player P>
+bool Queen::validateField(const QPointF& t_field,
+                          MoveGenType t_genType) noexcept {
+    const King* king{ PlayerTraits<P>::king() };
+
     auto state = checkField(t_field, this, m_scene);
 
     if(state == FieldState::Friend ||
@@ -2441,14 +2710,21 @@ bool Queen::validateField(const QPointF& t_field) noexcept {
         return false;
     }
 
-    if(!m_king->inCheckAfterMove(t_field, m_lastPos)) {
-        if(state == FieldState::Enemy) {
+    // enemy blocks the path whether or not it can be captured
+    if(state == FieldState::Enemy) {
+        if(generatesCaptures(t_genType) &&
+           !king->inCheckAfterMove<P>(t_field, m_lastPos)
+        ) {
             addMove(new Attack(this, state.piece));
-            return false;
-        }
-        else if (state == FieldState::Empty) {
-            addMove(new Move(this, t_field));
         }
+        return false;
+    }
+
+    // empty field, check is expensive so skip it if quiets are not needed
+    if(generatesQuiets(t_genType) &&
+       !king->inCheckAfterMove<P>(t_field, m_lastPos)
+    ) {
+        addMove(new Move(this, t_field));
     }
 
     return true;
@@ -2474,6 +2750,8 @@ bool King::canAttackField(const QPointF& t_targetPos,
                           const QPointF& t_newDefenderPos,
                           const QPointF& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     // if target is next to this piece return true, else false
     bool isInRange = [&] {
         const int xDistance{
@@ -2494,8 +2772,10 @@ bool King::canAttackField(const QPointF& t_targetPos,
 
 bool King::canAttackField(const QPointF& t_targetPos,
                           const QPointF& t_newDefenderPos,
-                          std::vector<QPointF>&& t_ignoredPos) const
+                          const std::vector<QPointF>& t_ignoredPos) const
 {
+    STATS_COUNT(CanAttackField);
+
     // if target is next to this piece return true, else false
     bool isInRange = [&] {
         const int xDistance{
@@ -2514,11 +2794,16 @@ bool King::canAttackField(const QPointF& t_targetPos,
     return isInRange;
 }
 
+template<Player P>
 bool King::inCheckAfterMove(const QPointF& t_newPos,
                             const QPointF& t_oldPos) const noexcept
 {
-    return std::any_of(std::begin(m_enemyPieces),
-                       std::end(m_enemyPieces),
+    STATS_COUNT(InCheckAfterMove);
+
+    const Container& enemyPieces{ PlayerTraits<P>::enemyPieces() };
+
+    return std::any_of(std::begin(enemyPieces),
+                       std::end(enemyPieces),
                        [&](const ChessPiece* enemy) {
                            if(enemy->m_lastPos == t_newPos)
                                return false;
@@ -2526,20 +2811,42 @@ bool King::inCheckAfterMove(const QPointF& t_newPos,
                        });
 }
 
+template<Player P>
 bool King::inCheckAfterMove(const QPointF& t_newPos,
-                            std::vector<QPointF>&& t_oldPos) const noexcept
+                            const std::vector<QPointF>& t_oldPos) const noexcept
 {
-    return std::any_of(std::begin(m_enemyPieces),
-                       std::end(m_enemyPieces),
+    STATS_COUNT(InCheckAfterMove);
+
+    const Container& enemyPieces{ PlayerTraits<P>::enemyPieces() };
+
+    // pawn taken en passant is one of t_oldPos, it no longer attacks
+    return std::any_of(std::begin(enemyPieces),
+                       std::end(enemyPieces),
                        [&](const ChessPiece* enemy) {
-                           if(enemy->m_lastPos == t_newPos)
+                           if(enemy->m_lastPos == t_newPos ||
+                              ::contains(t_oldPos, enemy->m_lastPos))
                                return false;
-                           return enemy->canAttackField(m_lastPos,
-                                                        t_newPos,
-                       std::forward<decltype(t_oldPos)>(t_oldPos));
+                           return enemy->canAttackField(m_lastPos, t_newPos, t_oldPos);
                        });
 }
 
+bool King::inCheckAfterMove(const QPointF& t_newPos,
+                            const QPointF& t_oldPos) const noexcept
+{
+    return m_player == Player::White ?
+                inCheckAfterMove<Player::White>(t_newPos, t_oldPos) :
+                inCheckAfterMove<Player::Black>(t_newPos, t_oldPos);
+}
+
+bool King::inCheckAfterMove(const QPointF& t_newPos,
+                            const std::vector<QPointF>& t_oldPos) const noexcept
+{
+    return m_player == Player::White ?
+                inCheckAfterMove<Player::White>(t_newPos, t_oldPos) :
+                inCheckAfterMove<Player::Black>(t_newPos, t_oldPos);
+}
+
+template<Player P>
 bool King::haveValidMoves() const noexcept {
     const std::array<QPointF, 8> posToCheck{{
             // left-top
@@ -2577,7 +2884,7 @@ bool King::haveValidMoves() const noexcept {
             continue;
         }
 
-        if(!inCheckAfterMove(pos)) {
+        if(!inCheckAfterMove<P>(pos)) {
             return true;
         }
     }
@@ -2585,7 +2892,17 @@ bool King::haveValidMoves() const noexcept {
     return false;
 }
 
-size_t King::findValidMoves() noexcept {
+bool King::haveValidMoves() const noexcept {
+    STATS_COUNT(HaveValidMoves);
+
+    return m_player == Player::White ? haveValidMoves<Player::White>() :
+                                       haveValidMoves<Player::Black>();
+}
+
+template<Player P>
+size_t King::findValidMoves(MoveGenType t_genType) noexcept {
+    const Container& enemyPieces{ PlayerTraits<P>::enemyPieces() };
+
     const std::array<QPointF, 8> posToCheck{{
             // left-top
             {m_lastPos.x() - BoardSizes::FieldWidth,
@@ -2622,7 +2939,13 @@ size_t King::findValidMoves() noexcept {
             continue;
         }
 
-        if(!inCheckAfterMove(pos)) {
+        if((state == FieldState::Enemy && !generatesCaptures(t_genType)) ||
+           (state == FieldState::Empty && !generatesQuiets(t_genType))
+        ) {
+            continue;
+        }
+
+        if(!inCheckAfterMove<P>(pos)) {
             if(state == FieldState::Enemy) {
                 addMove(new Attack(this, state.piece));
             }
@@ -2633,9 +2956,10 @@ size_t King::findValidMoves() noexcept {
     }
 
     // castle
-    if(m_firstMove && // if enemy cannot attack current pos
-       std::none_of(std::begin(m_enemyPieces),
-                    std::end(m_enemyPieces),
+    if(generatesQuiets(t_genType) &&
+       m_firstMove && // if enemy cannot attack current pos
+       std::none_of(std::begin(enemyPieces),
+                    std::end(enemyPieces),
                     [&](const ChessPiece* enemy) {
                         return enemy->canAttackField(m_lastPos, {-1, -1}, {-1, -1});
                     })
@@ -2655,8 +2979,8 @@ size_t King::findValidMoves() noexcept {
 
                 if(checkField(rookDest, this, m_scene) == FieldState::Empty &&
                    checkField(kingDest, this, m_scene) == FieldState::Empty &&
-                   std::none_of(std::begin(m_enemyPieces),
-                                std::end(m_enemyPieces),
+                   std::none_of(std::begin(enemyPieces),
+                                std::end(enemyPieces),
                                 [&](const ChessPiece* enemy) {
                                     return enemy->canAttackField(rookDest, {-1, -1}, m_lastPos) ||
                                            enemy->canAttackField(kingDest, {-1, -1}, m_lastPos);
@@ -2681,8 +3005,8 @@ size_t King::findValidMoves() noexcept {
                 if(checkField(rookDest, this, m_scene) == FieldState::Empty &&
                    checkField(kingDest, this, m_scene) == FieldState::Empty &&
                    checkField(emptyPos, this, m_scene) == FieldState::Empty &&
-                   std::none_of(std::begin(m_enemyPieces),
-                                std::end(m_enemyPieces),
+                   std::none_of(std::begin(enemyPieces),
+                                std::end(enemyPieces),
                                 [&](const ChessPiece* enemy) {
                                     return enemy->canAttackField(rookDest, {-1, -1}, m_lastPos) ||
                                            enemy->canAttackField(kingDest, {-1, -1}, m_lastPos);
@@ -2697,12 +3021,46 @@ size_t King::findValidMoves() noexcept {
     return m_moves.size();
 }
 
+size_t King::findValidMoves(MoveGenType t_genType) noexcept {
+    return m_player == Player::White ? findValidMoves<Player::White>(t_genType) :
+                                       findValidMoves<Player::Black>(t_genType);
+}
+
+template<Player P>
 bool King::inCheckAfterMove(const QPointF& t_KingNewPos) const noexcept {
-    return std::any_of(std::begin(m_enemyPieces),
-                       std::end(m_enemyPieces),
+    STATS_COUNT(InCheckAfterMove);
+
+    const Container& enemyPieces{ PlayerTraits<P>::enemyPieces() };
+
+    return std::any_of(std::begin(enemyPieces),
+                       std::end(enemyPieces),
                        [&](const ChessPiece* enemy) {
                            return enemy->canAttackField(t_KingNewPos, {-1, -1}, m_lastPos);
                        });
 }
 
 //
+
+#ifdef QTCHESS_BENCHMARK
+size_t BenchmarkAccess::findValidMoves(ChessPiece* t_piece,
+                                       MoveGenType t_genType) noexcept
+{
+    return t_piece->findValidMoves(t_genType);
+}
+
+const std::vector<std::unique_ptr<Movement>>& BenchmarkAccess::moves() noexcept {
+    return ChessPiece::m_moves;
+}
+
+void BenchmarkAccess::clearMoves() noexcept {
+    ChessPiece::m_moves.clear();
+}
+
+std::pair<WinCondition, Player> BenchmarkAccess::isGameOver(const ChessPiece* t_piece) noexcept {
+    return t_piece->isGameOver();
+}
+
+bool BenchmarkAccess::checkField(const QPointF& t_pos, const ChessPiece* t_piece) noexcept {
+    return ::checkField(t_pos, t_piece, t_piece->m_scene) == FieldState::Empty;
+}
+#endif
@@ -36,16 +36,38 @@ public:
 
     virtual ~ChessPiece() = default;
 
+    // state of a newly created piece at t_point, used by PiecePool
+    virtual void reset(const QPointF& t_point,
+                       QGraphicsScene* t_scene,
+                       bool t_firstMove);
+
     virtual bool canAttackField(const QPointF& t_targetPos,
                                 const QPointF& t_newDefenderPos = {-1, -1},
                                 const QPointF& t_ignoredPos = {-1, -1}) const = 0;
 
     virtual bool canAttackField(const QPointF& t_targetPos,
                                 const QPointF& t_newDefenderPos,
-                                std::vector<QPointF>&& t_ignoredPos) const = 0;
+                                const std::vector<QPointF>& t_ignoredPos) const = 0;
 
     virtual bool haveValidMoves() const noexcept = 0;
 
+    // static exchange evaluation - material won by capturing t_victim
+    // with t_attacker, taking into account all following recaptures.
+    // Pins are not checked, so a pinned piece still takes part in the
+    // exchange, and promotion is not counted, a pawn is worth a pawn.
+    static int staticExchange(const ChessPiece* t_attacker,
+                              const ChessPiece* t_victim) noexcept;
+
+    // capture landing on t_dest instead of the victim's field (en passant)
+    static int staticExchange(const ChessPiece* t_attacker,
+                              const ChessPiece* t_victim,
+                              const QPointF& t_dest) noexcept;
+
+    // material lost (negative value) if this piece moves to t_dest
+    int exchangeAfterMove(const QPointF& t_dest) const noexcept;
+
+    friend struct BenchmarkAccess;
+
 private:
     std::pair<WinCondition, Player> isGameOver() const noexcept;
 
@@ -59,7 +81,11 @@ protected:
     virtual void mousePressEvent(QGraphicsSceneMouseEvent* t_event);
     virtual void mouseReleaseEvent(QGraphicsSceneMouseEvent* t_event);
 
-    virtual size_t findValidMoves() noexcept = 0;
+    // t_genType allows to generate captures and quiet moves separately
+    virtual size_t findValidMoves(MoveGenType t_genType) noexcept = 0;
+
+    // all moves, captures and quiet
+    size_t findValidMoves() noexcept;
 
     void highlight();
     void dehighlight();
@@ -96,10 +122,14 @@ public:
 
     bool canAttackField(const QPointF& t_targetPos,
                         const QPointF& t_newDefenderPos,
-                        std::vector<QPointF>&& t_ignoredPos) const override;
+                        const std::vector<QPointF>& t_ignoredPos) const override;
 
     bool haveValidMoves() const noexcept override;
 
+    void reset(const QPointF& t_point,
+               QGraphicsScene* t_scene,
+               bool t_firstMove) override;
+
     void promote();
 
     bool enPassant() const noexcept;
@@ -107,7 +137,18 @@ public:
     bool m_enPassant{ false };
 
 private:
-    size_t findValidMoves() noexcept override;
+    size_t findValidMoves(MoveGenType t_genType) noexcept override;
+
+    template<Player P>
+    size_t findValidMoves(MoveGenType t_genType) noexcept;
+
+    template<Player P>
+    bool haveValidMoves() const noexcept;
+
+    // pawn cannot be blocked, ignored positions are not needed
+    template<Player P>
+    bool canAttackField(const QPointF& t_targetPos,
+                        const QPointF& t_newDefenderPos) const noexcept;
 };
 
 class Knight final : public ChessPiece
@@ -122,12 +163,18 @@ public:
 
     bool canAttackField(const QPointF& t_targetPos,
                         const QPointF& t_newDefenderPos,
-                        std::vector<QPointF>&& t_ignoredPos) const override;
+                        const std::vector<QPointF>& t_ignoredPos) const override;
 
     bool haveValidMoves() const noexcept override;
 
 private:
-    size_t findValidMoves() noexcept override;
+    size_t findValidMoves(MoveGenType t_genType) noexcept override;
+
+    template<Player P>
+    size_t findValidMoves(MoveGenType t_genType) noexcept;
+
+    template<Player P>
+    bool haveValidMoves() const noexcept;
 };
 
 class Bishop final : public ChessPiece
@@ -142,14 +189,21 @@ public:
 
     bool canAttackField(const QPointF& t_targetPos,
                         const QPointF& t_newDefenderPos,
-                        std::vector<QPointF>&& t_ignoredPos) const override;
+                        const std::vector<QPointF>& t_ignoredPos) const override;
 
     bool haveValidMoves() const noexcept override;
 
 private:
-    size_t findValidMoves() noexcept override;
+    size_t findValidMoves(MoveGenType t_genType) noexcept override;
+
+    template<Player P>
+    size_t findValidMoves(MoveGenType t_genType) noexcept;
 
-    bool validateField(const QPointF& t_field) noexcept;
+    template<Player P>
+    bool haveValidMoves() const noexcept;
+
+    template<Player P>
+    bool validateField(const QPointF& t_field, MoveGenType t_genType) noexcept;
 };
 
 class Rook final : public ChessPiece
@@ -164,14 +218,21 @@ public:
 
     bool canAttackField(const QPointF& t_targetPos,
                         const QPointF& t_newDefenderPos,
-                        std::vector<QPointF>&& t_ignoredPos) const override;
+                        const std::vector<QPointF>& t_ignoredPos) const override;
 
     bool haveValidMoves() const noexcept override;
 
 private:
-    size_t findValidMoves() noexcept override;
+    size_t findValidMoves(MoveGenType t_genType) noexcept override;
+
+    template<Player P>
+    size_t findValidMoves(MoveGenType t_genType) noexcept;
 
-    bool validateField(const QPointF& t_field) noexcept;
+    template<Player P>
+    bool haveValidMoves() const noexcept;
+
+    template<Player P>
+    bool validateField(const QPointF& t_field, MoveGenType t_genType) noexcept;
 };
 
 class Queen final : public ChessPiece
@@ -186,14 +247,21 @@ public:
 
     bool canAttackField(const QPointF& t_targetPos,
                         const QPointF& t_newDefenderPos,
-                        std::vector<QPointF>&& t_ignoredPos) const override;
+                        const std::vector<QPointF>& t_ignoredPos) const override;
 
     bool haveValidMoves() const noexcept override;
 
 private:
-    size_t findValidMoves() noexcept override;
+    size_t findValidMoves(MoveGenType t_genType) noexcept override;
+
+    template<Player P>
+    size_t findValidMoves(MoveGenType t_genType) noexcept;
+
+    template<Player P>
+    bool haveValidMoves() const noexcept;
 
-    bool validateField(const QPointF& t_field) noexcept;
+    template<Player P>
+    bool validateField(const QPointF& t_field, MoveGenType t_genType) noexcept;
 };
 
 class King final : public ChessPiece
@@ -208,22 +276,57 @@ public:
 
     bool canAttackField(const QPointF& t_targetPos,
                         const QPointF& t_newDefenderPos,
-                        std::vector<QPointF>&& t_ignoredPos) const override;
+                        const std::vector<QPointF>& t_ignoredPos) const override;
 
     bool haveValidMoves() const noexcept override;
 
-    bool inCheckAfterMove(const QPointF& t_oldPos,
-                          const QPointF& t_newPos) const noexcept;
+    bool inCheckAfterMove(const QPointF& t_newPos,
+                          const QPointF& t_oldPos) const noexcept;
 
     // for pawn (en passant)
     bool inCheckAfterMove(const QPointF& t_newPos,
-                          std::vector<QPointF>&& t_oldPos) const noexcept;
+                          const std::vector<QPointF>& t_oldPos) const noexcept;
+
+    // used by move generators specialised for the owner of this king
+    template<Player P>
+    bool inCheckAfterMove(const QPointF& t_newPos,
+                          const QPointF& t_oldPos) const noexcept;
+
+    template<Player P>
+    bool inCheckAfterMove(const QPointF& t_newPos,
+                          const std::vector<QPointF>& t_oldPos) const noexcept;
 
 private:
-    size_t findValidMoves() noexcept override;
+    size_t findValidMoves(MoveGenType t_genType) noexcept override;
+
+    template<Player P>
+    size_t findValidMoves(MoveGenType t_genType) noexcept;
+
+    template<Player P>
+    bool haveValidMoves() const noexcept;
 
     // for king
+    template<Player P>
     bool inCheckAfterMove(const QPointF& t_KingNewPos) const noexcept;
 };
 
+#ifdef QTCHESS_BENCHMARK
+// internals of the move generator used by benchmarks/
+struct BenchmarkAccess
+{
+    static size_t findValidMoves(ChessPiece* t_piece,
+                                 MoveGenType t_genType = MoveGenType::All) noexcept;
+
+    // moves found since last clearMoves
+    static const std::vector<std::unique_ptr<Movement>>& moves() noexcept;
+
+    static void clearMoves() noexcept;
+
+    static std::pair<WinCondition, Player> isGameOver(const ChessPiece* t_piece) noexcept;
+
+    // true if field is empty
+    static bool checkField(const QPointF& t_pos, const ChessPiece* t_piece) noexcept;
+};
+#endif
+
 #endif // CHESSPIECE_H
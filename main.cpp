@@ -1,5 +1,8 @@
 #include "mainwindow.h"
+#include "trace.h"
+#include "allocations.h"
 #include <QApplication>
+#include <QDebug>
 
 int main(int argc, char *argv[])
 {
@@ -7,5 +10,15 @@ int main(int argc, char *argv[])
     MainWindow w;
     w.show();
 
-    return a.exec();
+    const int result = a.exec();
+
+#ifdef QTCHESS_TRACING
+    Trace::writeOnExit();
+#endif
+
+#ifdef QTCHESS_ALLOCATIONS
+    qInfo().noquote() << "allocations:" << Allocations::toJson();
+#endif
+
+    return result;
 }
@@ -1,11 +1,20 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
-#include <QGraphicsRectItem>
 #include <QGraphicsItem>
+#include <QPainter>
 
+#include "board.h"
 #include "chess_namespaces.h"
 #include "chesspiece.h"
-#include "paths.h"
+#include "piecepool.h"
+#include "sprites.h"
+
+#ifdef QTCHESS_STATISTICS
+#include "statistics.h"
+
+#include <QDockWidget>
+#include <QPlainTextEdit>
+#endif
 
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
@@ -16,10 +25,14 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(ui->actionNew_game, &QAction::triggered,
             this, &MainWindow::newGame);
 
-    ui->graphicsView->setFixedHeight(static_cast<int>(BoardSizes::BoardHeight));
-    ui->graphicsView->setFixedWidth(static_cast<int>(BoardSizes::BoardWidth));
+    // board is scaled to the view, fields keep their logical size
+    ui->graphicsView->setMinimumSize(static_cast<int>(BoardSizes::BoardWidth  / 2),
+                                     static_cast<int>(BoardSizes::BoardHeight / 2));
+    ui->graphicsView->setRenderHint(QPainter::SmoothPixmapTransform);
 
-    setFixedSize(size());
+#ifdef QTCHESS_STATISTICS
+    createStatisticsPanel();
+#endif
 
     DrawBoard();
 
@@ -27,68 +40,96 @@ MainWindow::MainWindow(QWidget *parent) :
 
 #if 1 // test
     PlacePieces({
-    //std::make_tuple(QPixmap{ Paths::Black::knight }, PieceType::Knight, index_to_point(5, 7), Player::Black, 1),
-    std::make_tuple(QPixmap{ Paths::Black::queen  }, PieceType::Queen,  index_to_point(4, 1), Player::Black, 1),
-    std::make_tuple(QPixmap{ Paths::Black::king   }, PieceType::King,   index_to_point(5, 1), Player::Black, 1),
-    std::make_tuple(QPixmap{ Paths::Black::bishop }, PieceType::Bishop, index_to_point(6, 1), Player::Black, 1),
-    //std::make_tuple(QPixmap{ Paths::Black::pawn   }, PieceType::Pawn,   index_to_point(2, 5), Player::Black, 1),
-
-    std::make_tuple(QPixmap{ Paths::White::king   }, PieceType::King,   index_to_point(5, 6), Player::White, 1),
-    std::make_tuple(QPixmap{ Paths::White::queen  }, PieceType::Queen,  index_to_point(4, 8), Player::White, 1),
-    std::make_tuple(QPixmap{ Paths::White::pawn   }, PieceType::Pawn,   index_to_point(1, 2), Player::White, 1),
-    //std::make_tuple(QPixmap{ Paths::White::rook   }, PieceType::Rook,   index_to_point(8, 8), Player::White, 1)
+    //std::make_tuple(PieceType::Knight, index_to_point(5, 7), Player::Black, 1),
+    std::make_tuple(PieceType::Queen,  index_to_point(4, 1), Player::Black, 1),
+    std::make_tuple(PieceType::King,   index_to_point(5, 1), Player::Black, 1),
+    std::make_tuple(PieceType::Bishop, index_to_point(6, 1), Player::Black, 1),
+    //std::make_tuple(PieceType::Pawn,   index_to_point(2, 5), Player::Black, 1),
+
+    std::make_tuple(PieceType::King,   index_to_point(5, 6), Player::White, 1),
+    std::make_tuple(PieceType::Queen,  index_to_point(4, 8), Player::White, 1),
+    std::make_tuple(PieceType::Pawn,   index_to_point(1, 2), Player::White, 1),
+    //std::make_tuple(PieceType::Rook,   index_to_point(8, 8), Player::White, 1)
     });
 #endif
 }
 
 MainWindow::~MainWindow()
 {
+    // pooled pieces are not owned by scene
+    PiecePool::clear();
     delete ui;
 }
 
+#ifdef QTCHESS_STATISTICS
+void MainWindow::createStatisticsPanel() {
+    constexpr const int panelWidth = 260;
+
+    auto* text = new QPlainTextEdit(this);
+    text->setReadOnly(true);
+    text->setPlainText(QString::fromUtf8(Statistics::toJson()));
+
+    auto* dock = new QDockWidget(tr("Statistics"), this);
+    dock->setFeatures(QDockWidget::NoDockWidgetFeatures);
+    dock->setMinimumWidth(panelWidth);
+    dock->setWidget(text);
+    addDockWidget(Qt::RightDockWidgetArea, dock);
+
+    resize(width() + panelWidth, height());
+
+    Statistics::setListener([text](const QByteArray& t_json) {
+        text->setPlainText(QString::fromUtf8(t_json));
+    });
+}
+#endif
+
 void MainWindow::DrawBoard() {
     auto* scene = new QGraphicsScene(this);
     ui->graphicsView->setScene(scene);
 
-    bool color = 1; // true = white, false = black;
-    for(int y = 0; y < BoardSizes::MaxColCount; ++y){
-        for(int x = 0; x < BoardSizes::MaxRowCount; ++x){
-            auto* field = new QGraphicsRectItem(0, 0,
-                                                BoardSizes::FieldWidth,
-                                                BoardSizes::FieldHeight);
-            field->setPos(x * BoardSizes::FieldWidth,
-                          y * BoardSizes::FieldHeight);
+    // pieces dragged outside must not grow the scene
+    scene->setSceneRect(0, 0, BoardSizes::BoardWidth, BoardSizes::BoardHeight);
 
-            field->setBrush(color ? BoardBrush::White :
-                                    BoardBrush::Black);
+    GameStatus::board = new Board;
+    scene->addItem(GameStatus::board);
+}
+
+void MainWindow::fitBoard() {
+    ui->graphicsView->fitInView(ui->graphicsView->sceneRect(), Qt::KeepAspectRatio);
+
+    const qreal fieldPixels{ BoardSizes::FieldWidth *
+                             ui->graphicsView->transform().m11() *
+                             ui->graphicsView->devicePixelRatioF() };
+
+    Sprites::setDeviceSize(fieldPixels, this, [this] {
+        updateSprites();
+    });
+}
 
-            color = !color;
-            scene->addItem(std::move(field));
+void MainWindow::updateSprites() {
+    for(auto* pieces : { &GameStatus::White::pieces, &GameStatus::Black::pieces }) {
+        for(ChessPiece* piece : *pieces) {
+            piece->setPixmap(Sprites::piece(piece->m_type, piece->m_player));
         }
-        // shift colors to right
-        color = !color;
     }
 }
 
 void MainWindow::PlacePieces(
-        std::vector<std::tuple<const QPixmap&,
-                               PieceType,
-                               const QPointF&,
+        std::vector<std::tuple<PieceType,
+                               QPointF,
                                Player,
                                bool // first move
                              >>&& q)
 {
     auto* scene = ui->graphicsView->scene();
 
-    constexpr const size_t pixmap    = 0;
-    constexpr const size_t piecetype = 1;
-    constexpr const size_t qpointf   = 2;
-    constexpr const size_t player    = 3;
-    constexpr const size_t firstMove = 4;
+    constexpr const size_t piecetype = 0;
+    constexpr const size_t qpointf   = 1;
+    constexpr const size_t player    = 2;
+    constexpr const size_t firstMove = 3;
 
     for(const auto& row : q) {
-        ChessPiece* item = ChessPiece::Create(std::get<pixmap>(row),
-                                              std::get<piecetype>(row),
+        ChessPiece* item = PiecePool::acquire(std::get<piecetype>(row),
                                               std::get<qpointf>(row),
                                               std::get<player>(row),
                                               scene,
@@ -106,57 +147,59 @@ void MainWindow::PlacePieces(
             GameStatus::Black::pieces.push_back(item);
         }
 
+        GameStatus::material.add(std::get<piecetype>(row),
+                                 std::get<player>(row),
+                                 std::get<qpointf>(row));
+
         scene->addItem(item);
     }
 }
 
 void MainWindow::PlacePieces() {
-    const std::array<std::tuple<const QPixmap&, PieceType, const QPointF&, Player>, 32> q{{
-        std::make_tuple(QPixmap{":/Pieces/rook_black"},   PieceType::Rook,   index_to_point(1, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/knight_black"}, PieceType::Knight, index_to_point(2, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/bishop_black"}, PieceType::Bishop, index_to_point(3, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/queen_black"},  PieceType::Queen,  index_to_point(4, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/king_black"},   PieceType::King,   index_to_point(5, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/bishop_black"}, PieceType::Bishop, index_to_point(6, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/knight_black"}, PieceType::Knight, index_to_point(7, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/rook_black"},   PieceType::Rook,   index_to_point(8, 1), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(1, 2), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(2, 2), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(3, 2), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(4, 2), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(5, 2), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(6, 2), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(7, 2), Player::Black),
-        std::make_tuple(QPixmap{":/Pieces/pawn_black"},   PieceType::Pawn,   index_to_point(8, 2), Player::Black),
-
-        std::make_tuple(QPixmap{":/Pieces/rook_white"},   PieceType::Rook,   index_to_point(1, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/knight_white"}, PieceType::Knight, index_to_point(2, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/bishop_white"}, PieceType::Bishop, index_to_point(3, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/queen_white"},  PieceType::Queen,  index_to_point(4, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/king_white"},   PieceType::King,   index_to_point(5, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/bishop_white"}, PieceType::Bishop, index_to_point(6, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/knight_white"}, PieceType::Knight, index_to_point(7, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/rook_white"},   PieceType::Rook,   index_to_point(8, 8), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(1, 7), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(2, 7), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(3, 7), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(4, 7), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(5, 7), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(6, 7), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(7, 7), Player::White),
-        std::make_tuple(QPixmap{":/Pieces/pawn_white"},   PieceType::Pawn,   index_to_point(8, 7), Player::White)
+    const std::array<std::tuple<PieceType, QPointF, Player>, 32> q{{
+        std::make_tuple(PieceType::Rook,   index_to_point(1, 1), Player::Black),
+        std::make_tuple(PieceType::Knight, index_to_point(2, 1), Player::Black),
+        std::make_tuple(PieceType::Bishop, index_to_point(3, 1), Player::Black),
+        std::make_tuple(PieceType::Queen,  index_to_point(4, 1), Player::Black),
+        std::make_tuple(PieceType::King,   index_to_point(5, 1), Player::Black),
+        std::make_tuple(PieceType::Bishop, index_to_point(6, 1), Player::Black),
+        std::make_tuple(PieceType::Knight, index_to_point(7, 1), Player::Black),
+        std::make_tuple(PieceType::Rook,   index_to_point(8, 1), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(1, 2), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(2, 2), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(3, 2), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(4, 2), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(5, 2), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(6, 2), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(7, 2), Player::Black),
+        std::make_tuple(PieceType::Pawn,   index_to_point(8, 2), Player::Black),
+
+        std::make_tuple(PieceType::Rook,   index_to_point(1, 8), Player::White),
+        std::make_tuple(PieceType::Knight, index_to_point(2, 8), Player::White),
+        std::make_tuple(PieceType::Bishop, index_to_point(3, 8), Player::White),
+        std::make_tuple(PieceType::Queen,  index_to_point(4, 8), Player::White),
+        std::make_tuple(PieceType::King,   index_to_point(5, 8), Player::White),
+        std::make_tuple(PieceType::Bishop, index_to_point(6, 8), Player::White),
+        std::make_tuple(PieceType::Knight, index_to_point(7, 8), Player::White),
+        std::make_tuple(PieceType::Rook,   index_to_point(8, 8), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(1, 7), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(2, 7), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(3, 7), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(4, 7), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(5, 7), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(6, 7), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(7, 7), Player::White),
+        std::make_tuple(PieceType::Pawn,   index_to_point(8, 7), Player::White)
     }};
 
     auto* scene = ui->graphicsView->scene();
 
-    constexpr const size_t pixmap    = 0;
-    constexpr const size_t piecetype = 1;
-    constexpr const size_t qpointf   = 2;
-    constexpr const size_t player    = 3;
+    constexpr const size_t piecetype = 0;
+    constexpr const size_t qpointf   = 1;
+    constexpr const size_t player    = 2;
 
     for(const auto& row : q) {
-        ChessPiece* item = ChessPiece::Create(std::get<pixmap>(row),
-                                              std::get<piecetype>(row),
+        ChessPiece* item = PiecePool::acquire(std::get<piecetype>(row),
                                               std::get<qpointf>(row),
                                               std::get<player>(row),
                                               scene);
@@ -173,6 +216,10 @@ void MainWindow::PlacePieces() {
             GameStatus::Black::pieces.push_back(item);
         }
 
+        GameStatus::material.add(std::get<piecetype>(row),
+                                 std::get<player>(row),
+                                 std::get<qpointf>(row));
+
         scene->addItem(item);
     }
 }
@@ -184,15 +231,14 @@ inline QPointF MainWindow::index_to_point(const qreal& x,
 }
 
 void MainWindow::cleanUp() noexcept {
+    // pieces are reused by next game
     for(auto* piece : GameStatus::White::pieces) {
-        piece->m_scene->removeItem(piece);
-        delete piece;
+        PiecePool::release(piece);
     }
     GameStatus::White::pieces.clear();
 
     for(auto* piece : GameStatus::Black::pieces) {
-        piece->m_scene->removeItem(piece);
-        delete piece;
+        PiecePool::release(piece);
     }
     GameStatus::Black::pieces.clear();
 
@@ -201,7 +247,12 @@ void MainWindow::cleanUp() noexcept {
 
     GameStatus::currentPlayer = Player::White;
 
-    GameStatus::promotedPieces.clear();
+    GameStatus::material.clear();
+
+#ifdef QTCHESS_STATISTICS
+    Statistics::reset();
+    Statistics::report();
+#endif
 }
 
 void MainWindow::newGame() noexcept {
@@ -210,7 +261,11 @@ void MainWindow::newGame() noexcept {
 }
 
 void MainWindow::showEvent(QShowEvent* event) {
-    ui->graphicsView->centerOn({BoardSizes::BoardHeight / 2,
-                                BoardSizes::BoardWidth  / 2});
-    QWidget::showEvent(event);
+    fitBoard();
+    QMainWindow::showEvent(event);
+}
+
+void MainWindow::resizeEvent(QResizeEvent* event) {
+    QMainWindow::resizeEvent(event);
+    fitBoard();
 }
@@ -26,9 +26,12 @@ public:
 private:
     void DrawBoard();
 
-    void PlacePieces(std::vector<std::tuple<const QPixmap&,
-                                            PieceType,
-                                            const QPointF&,
+    // scales board to the view and requests sprites for new size
+    void fitBoard();
+    void updateSprites();
+
+    void PlacePieces(std::vector<std::tuple<PieceType,
+                                            QPointF,
                                             Player,
                                             bool>>&&);
 
@@ -38,6 +41,10 @@ private:
 
     void cleanUp() noexcept;
 
+#ifdef QTCHESS_STATISTICS
+    void createStatisticsPanel();
+#endif
+
     Ui::MainWindow *ui;
 
 public slots:
@@ -45,6 +52,7 @@ public slots:
 
 protected:
     void showEvent(QShowEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
 };
 
 #endif // MAINWINDOW_H
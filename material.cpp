@@ -0,0 +1,110 @@
+#include "material.h"
+#include "chess_namespaces.h"
+
+#include <algorithm>
+
+namespace {
+    // layout of the key:
+    //  bits  0-23  white pieces, 4 bits per type in order of pieceIndex()
+    //  bits 24-47  black pieces
+    //  bits 48-55  bishops on white fields, both players
+    //  bits 56-63  bishops on black fields, both players
+    // a player has at most 10 pieces of a type, but with underpromotions
+    // both players together can have up to 20 bishops on one color
+    constexpr const int counterBits = 4;
+    constexpr const quint64 counterMask = (1 << counterBits) - 1;
+
+    constexpr const int bishopsBits = 8;
+    constexpr const quint64 bishopsMask = (1 << bishopsBits) - 1;
+
+    constexpr const int whiteBishopsShift = 2 * PieceTypeCount * counterBits;
+    constexpr const int blackBishopsShift = whiteBishopsShift + bishopsBits;
+
+    constexpr int counterShift(PieceType t_type, Player t_player) noexcept {
+        return counterBits * pieceIndex(t_type, t_player);
+    }
+
+    constexpr quint64 counterFor(PieceType t_type, Player t_player) noexcept {
+        return counterMask << counterShift(t_type, t_player);
+    }
+
+    // pieces which are always enough to checkmate
+    constexpr const quint64 matingMaterial{
+        counterFor(PieceType::Pawn,  Player::White) |
+        counterFor(PieceType::Rook,  Player::White) |
+        counterFor(PieceType::Queen, Player::White) |
+        counterFor(PieceType::Pawn,  Player::Black) |
+        counterFor(PieceType::Rook,  Player::Black) |
+        counterFor(PieceType::Queen, Player::Black)
+    };
+
+    // [knights on board, at most 2][bishops present on white | black fields]
+    // without pawns, rooks and queens only these positions are dead:
+    //   king vs king
+    //   king + knight vs king
+    //   kings + any number of bishops standing on fields of one color
+    constexpr const bool deadPosition[3][4] = {
+        //  none   white  black  both
+        {   true,  true,  true,  false }, // no knights
+        {   true,  false, false, false }, // one knight
+        {   false, false, false, false }  // two or more knights
+    };
+
+    int bishopsShift(const QPointF& t_pos) noexcept {
+        const int col{ static_cast<int>(t_pos.x() / BoardSizes::FieldWidth)  };
+        const int row{ static_cast<int>(t_pos.y() / BoardSizes::FieldHeight) };
+
+        // top-left field is white
+        return (col + row) % 2 == 0 ? whiteBishopsShift : blackBishopsShift;
+    }
+}
+
+void MaterialKey::add(PieceType t_type, Player t_player, const QPointF& t_pos) noexcept {
+    Q_ASSERT_X(count(t_type, t_player) < static_cast<int>(counterMask), "MaterialKey::add",
+                                                                        "too many pieces of one type");
+
+    m_key += quint64{ 1 } << counterShift(t_type, t_player);
+
+    if(t_type == PieceType::Bishop) {
+        m_key += quint64{ 1 } << bishopsShift(t_pos);
+    }
+}
+
+void MaterialKey::remove(PieceType t_type, Player t_player, const QPointF& t_pos) noexcept {
+    Q_ASSERT_X(count(t_type, t_player) > 0, "MaterialKey::remove",
+                                            "removing piece that was not added");
+
+    m_key -= quint64{ 1 } << counterShift(t_type, t_player);
+
+    if(t_type == PieceType::Bishop) {
+        m_key -= quint64{ 1 } << bishopsShift(t_pos);
+    }
+}
+
+void MaterialKey::clear() noexcept {
+    m_key = 0;
+}
+
+quint64 MaterialKey::key() const noexcept {
+    return m_key;
+}
+
+int MaterialKey::count(PieceType t_type, Player t_player) const noexcept {
+    return static_cast<int>((m_key >> counterShift(t_type, t_player)) & counterMask);
+}
+
+bool MaterialKey::insufficientMaterial() const noexcept {
+    if(m_key & matingMaterial) {
+        return false;
+    }
+
+    const int knights{ std::min(count(PieceType::Knight, Player::White) +
+                                count(PieceType::Knight, Player::Black), 2) };
+
+    const int bishops{
+        (((m_key >> whiteBishopsShift) & bishopsMask) != 0 ? 1 : 0) |
+        (((m_key >> blackBishopsShift) & bishopsMask) != 0 ? 2 : 0)
+    };
+
+    return deadPosition[knights][bishops];
+}
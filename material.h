@@ -0,0 +1,31 @@
+#ifndef MATERIAL_H
+#define MATERIAL_H
+
+#include <QPointF>
+#include <QtGlobal>
+
+enum class PieceType : char;
+enum class Player : char;
+
+// Material signature of the position - number of pieces of every type
+// for both players and field colors of bishops, packed into one integer.
+// Updated when pieces are placed, captured or promoted, so end of game
+// checks do not have to scan piece containers after every move.
+class MaterialKey
+{
+public:
+    void add(PieceType t_type, Player t_player, const QPointF& t_pos) noexcept;
+    void remove(PieceType t_type, Player t_player, const QPointF& t_pos) noexcept;
+    void clear() noexcept;
+
+    quint64 key() const noexcept;
+    int count(PieceType t_type, Player t_player) const noexcept;
+
+    // neither player is able to checkmate
+    bool insufficientMaterial() const noexcept;
+
+private:
+    quint64 m_key{ 0 };
+};
+
+#endif // MATERIAL_H
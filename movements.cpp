@@ -1,12 +1,16 @@
 #include "movements.h"
 #include "chess_namespaces.h"
 #include "chesspiece.h"
+#include "piecepool.h"
 
 Movement::Movement(const QPointF& t_point, const MoveType t_type) noexcept
     : m_coordinates(t_point), m_type(t_type)
 {
 }
 
+void Movement::evaluateExchange() noexcept {
+}
+
 bool operator ==(const std::unique_ptr<Movement>& t_move,
                  const QPointF& t_coordinates) noexcept
 {
@@ -56,15 +60,25 @@ void AttackingType::removePiece(ChessPiece* t_enemy) {
         pieces.erase(it);
     }
 
-    t_enemy->m_scene->removeItem(t_enemy);
-    delete t_enemy; // neccessary, as no longer owned by scene
+    GameStatus::material.remove(t_enemy->m_type,
+                                t_enemy->m_player,
+                                t_enemy->m_lastPos);
+
+    PiecePool::release(t_enemy);
 }
 
 void Move::exec() {
     movePiece(m_self, m_moveDest);
 }
 
+void Move::evaluateExchange() noexcept {
+    m_losing = m_self->exchangeAfterMove(m_moveDest) < 0;
+}
+
 const QBrush& Move::getHightlightColor() const noexcept {
+    if(m_losing) {
+        return m_losingHightlightColor;
+    }
     return m_hightlightColor;
 }
 
@@ -82,7 +96,14 @@ void Attack::exec() {
     removePiece(m_enemy);
 }
 
+void Attack::evaluateExchange() noexcept {
+    m_losing = ChessPiece::staticExchange(m_self, m_enemy) < 0;
+}
+
 const QBrush& Attack::getHightlightColor() const noexcept {
+    if(m_losing) {
+        return m_losingHightlightColor;
+    }
     return m_hightlightColor;
 }
 
@@ -117,7 +138,14 @@ void EnPassantAttack::exec() {
     removePiece(m_enemy);
 }
 
+void EnPassantAttack::evaluateExchange() noexcept {
+    m_losing = ChessPiece::staticExchange(m_self, m_enemy, m_moveDest) < 0;
+}
+
 const QBrush& EnPassantAttack::getHightlightColor() const noexcept {
+    if(m_losing) {
+        return m_losingHightlightColor;
+    }
     return m_hightlightColor;
 }
 
@@ -133,7 +161,14 @@ void EnPassantMove::exec() {
     m_self->m_enPassant = true;
 }
 
+void EnPassantMove::evaluateExchange() noexcept {
+    m_losing = m_self->exchangeAfterMove(m_moveDest) < 0;
+}
+
 const QBrush& EnPassantMove::getHightlightColor() const noexcept {
+    if(m_losing) {
+        return m_losingHightlightColor;
+    }
     return m_hightlightColor;
 }
 
@@ -149,7 +184,14 @@ void PromotionMove::exec() {
     m_self->promote();
 }
 
+void PromotionMove::evaluateExchange() noexcept {
+    m_losing = m_self->exchangeAfterMove(m_moveDest) < 0;
+}
+
 const QBrush& PromotionMove::getHightlightColor() const noexcept {
+    if(m_losing) {
+        return m_losingHightlightColor;
+    }
     return m_hightlightColor;
 }
 
@@ -168,7 +210,14 @@ void PromotionAttack::exec() {
     m_self->promote();
 }
 
+void PromotionAttack::evaluateExchange() noexcept {
+    m_losing = ChessPiece::staticExchange(m_self, m_enemy) < 0;
+}
+
 const QBrush& PromotionAttack::getHightlightColor() const noexcept {
+    if(m_losing) {
+        return m_losingHightlightColor;
+    }
     return m_hightlightColor;
 }
 
@@ -186,3 +235,10 @@ const QBrush EnPassantMove::m_hightlightColor   = {Qt::GlobalColor::blue};
 const QBrush PromotionMove::m_hightlightColor   = {QColor(148,0,211)}; // purple
 const QBrush PromotionAttack::m_hightlightColor = {QColor(148,0,211)}; // purple
 
+const QBrush Move::m_losingHightlightColor            = {QColor(0,0,128)};   // navy
+const QBrush Attack::m_losingHightlightColor          = {QColor(128,0,0)};   // maroon
+const QBrush EnPassantAttack::m_losingHightlightColor = {QColor(75,0,130)};  // indigo
+const QBrush EnPassantMove::m_losingHightlightColor   = {QColor(0,0,128)};   // navy
+const QBrush PromotionMove::m_losingHightlightColor   = {QColor(75,0,130)};  // indigo
+const QBrush PromotionAttack::m_losingHightlightColor = {QColor(75,0,130)};  // indigo
+
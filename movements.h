@@ -15,9 +15,16 @@ struct Movement
 
     const MoveType m_type;
 
+    // move loses material after recaptures, set by evaluateExchange
+    bool m_losing{ false };
+
     virtual void exec() = 0;
     virtual const QBrush& getHightlightColor() const noexcept = 0;
 
+    // static exchange evaluation of the move, too costly for every
+    // generated move, so it is done only for moves shown to the player
+    virtual void evaluateExchange() noexcept;
+
     Movement(const QPointF& t_point, const MoveType t_type) noexcept;
 
     virtual ~Movement() = default;
@@ -48,11 +55,15 @@ struct Move : public Movement
     const QPointF m_moveDest;
 
     static const QBrush m_hightlightColor;
+    // piece can be captured on destination field and lose material
+    static const QBrush m_losingHightlightColor;
 
     void exec() override;
 
     const QBrush& getHightlightColor() const noexcept override;
 
+    void evaluateExchange() noexcept override;
+
     Move(ChessPiece* t_self, const QPointF& t_moveDest) noexcept;
 };
 
@@ -62,12 +73,16 @@ struct Attack : public Movement, public AttackingType
     ChessPiece* m_enemy;
 
     static const QBrush m_hightlightColor;
+    // capture loses material after recaptures
+    static const QBrush m_losingHightlightColor;
 
     // set pos of m_self to pos of m_enemy and delete m_enemy from board
     void exec() override;
 
     const QBrush& getHightlightColor() const noexcept override;
 
+    void evaluateExchange() noexcept override;
+
     Attack(ChessPiece* t_self, ChessPiece* t_enemy) noexcept;
 };
 
@@ -97,11 +112,15 @@ struct EnPassantAttack : public Movement, public AttackingType
     const QPointF m_moveDest;
 
     static const QBrush m_hightlightColor;
+    // capture loses material after recaptures
+    static const QBrush m_losingHightlightColor;
 
     void exec() override;
 
     const QBrush& getHightlightColor() const noexcept override;
 
+    void evaluateExchange() noexcept override;
+
     EnPassantAttack(ChessPiece* t_self, ChessPiece* t_enemy, const QPointF& t_moveDest) noexcept;
 };
 
@@ -111,11 +130,15 @@ struct EnPassantMove : public Movement
     const QPointF m_moveDest;
 
     static const QBrush m_hightlightColor;
+    // piece can be captured on destination field and lose material
+    static const QBrush m_losingHightlightColor;
 
     void exec() override;
 
     const QBrush& getHightlightColor() const noexcept override;
 
+    void evaluateExchange() noexcept override;
+
     EnPassantMove(Pawn* t_self, const QPointF& t_moveDest) noexcept;
 };
 
@@ -125,12 +148,16 @@ struct PromotionMove : public Movement
     const QPointF m_moveDest;
 
     static const QBrush m_hightlightColor;
+    // pawn can be captured on destination field and lose material
+    static const QBrush m_losingHightlightColor;
 
     // set pos of m_self to pos of m_enemy and delete m_enemy from board
     void exec() override;
 
     const QBrush& getHightlightColor() const noexcept override;
 
+    void evaluateExchange() noexcept override;
+
     PromotionMove(Pawn* t_self, const QPointF& t_moveDest) noexcept;
 };
 
@@ -140,12 +167,16 @@ struct PromotionAttack : public Movement, public AttackingType
     ChessPiece* m_enemy;
 
     static const QBrush m_hightlightColor;
+    // capture loses material after recaptures
+    static const QBrush m_losingHightlightColor;
 
     // set pos of m_self to pos of m_enemy and delete m_enemy from board
     void exec() override;
 
     const QBrush& getHightlightColor() const noexcept override;
 
+    void evaluateExchange() noexcept override;
+
     PromotionAttack(Pawn* t_self, ChessPiece* t_enemy) noexcept;
 };
 
@@ -0,0 +1,47 @@
+#include "piecepool.h"
+
+#include "chess_namespaces.h"
+#include "chesspiece.h"
+
+#include <QGraphicsScene>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace {
+    // free pieces of every type and player
+    std::array<std::vector<std::unique_ptr<ChessPiece>>, 2 * PieceTypeCount> pool;
+}
+
+ChessPiece* PiecePool::acquire(PieceType       t_type,
+                               const QPointF&  t_point,
+                               Player          t_player,
+                               QGraphicsScene* t_scene,
+                               bool            t_firstMove)
+{
+    auto& free = pool[pieceIndex(t_type, t_player)];
+    if(free.empty()) {
+        return ChessPiece::Create(t_type, t_point, t_player, t_scene, t_firstMove);
+    }
+
+    ChessPiece* piece = free.back().release();
+    free.pop_back();
+
+    piece->reset(t_point, t_scene, t_firstMove);
+    return piece;
+}
+
+void PiecePool::release(ChessPiece* t_piece) {
+    if(t_piece->scene()) {
+        t_piece->scene()->removeItem(t_piece);
+    }
+
+    pool[pieceIndex(t_piece->m_type, t_piece->m_player)].emplace_back(t_piece);
+}
+
+void PiecePool::clear() noexcept {
+    for(auto& free : pool) {
+        free.clear();
+    }
+}
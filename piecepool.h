@@ -0,0 +1,32 @@
+#ifndef PIECEPOOL_H
+#define PIECEPOOL_H
+
+#include <QPointF>
+
+class ChessPiece;
+class QGraphicsScene;
+
+enum class PieceType : char;
+enum class Player : char;
+
+// Pieces removed from the board (captured, promoted pawns, pieces of
+// finished game) are kept for reuse instead of being deleted, so new
+// game and promotion reuse items instead of allocating new ones.
+namespace PiecePool {
+    // piece taken from the pool and reset, or a new one if pool is empty;
+    // the piece is not added to t_scene nor to GameStatus
+    ChessPiece* acquire(PieceType       t_type,
+                        const QPointF&  t_point,
+                        Player          t_player,
+                        QGraphicsScene* t_scene,
+                        bool            t_firstMove = true);
+
+    // removes piece from its scene and keeps it for reuse; it is not
+    // deleted, so a piece may release itself while handling its event
+    void release(ChessPiece* t_piece);
+
+    // deletes all pooled pieces
+    void clear() noexcept;
+}
+
+#endif // PIECEPOOL_H
@@ -3,7 +3,7 @@
 
 #include "chess_namespaces.h"
 #include "chesspiece.h"
-#include "paths.h"
+#include "sprites.h"
 
 PromotionDialog::PromotionDialog(ChessPiece* piece, QWidget* parent) :
     QDialog(parent),
@@ -33,16 +33,16 @@ PromotionDialog::PromotionDialog(ChessPiece* piece, QWidget* parent) :
                    ~Qt::WindowCloseButtonHint);
 
     if(m_piece->m_player == Player::White) {
-        ui->Knight->setIcon({ QPixmap{ Paths::White::knight } });
-        ui->Bishop->setIcon({ QPixmap{ Paths::White::bishop } });
-        ui->Rook->setIcon  ({ QPixmap{ Paths::White::rook   } });
-        ui->Queen->setIcon ({ QPixmap{ Paths::White::queen  } });
+        ui->Knight->setIcon({ Sprites::piece(PieceType::Knight, Player::White) });
+        ui->Bishop->setIcon({ Sprites::piece(PieceType::Bishop, Player::White) });
+        ui->Rook->setIcon  ({ Sprites::piece(PieceType::Rook, Player::White) });
+        ui->Queen->setIcon ({ Sprites::piece(PieceType::Queen, Player::White) });
     }
     else {
-        ui->Knight->setIcon({ QPixmap{ Paths::Black::knight } });
-        ui->Bishop->setIcon({ QPixmap{ Paths::Black::bishop } });
-        ui->Rook->setIcon  ({ QPixmap{ Paths::Black::rook   } });
-        ui->Queen->setIcon ({ QPixmap{ Paths::Black::queen  } });
+        ui->Knight->setIcon({ Sprites::piece(PieceType::Knight, Player::Black) });
+        ui->Bishop->setIcon({ Sprites::piece(PieceType::Bishop, Player::Black) });
+        ui->Rook->setIcon  ({ Sprites::piece(PieceType::Rook, Player::Black) });
+        ui->Queen->setIcon ({ Sprites::piece(PieceType::Queen, Player::Black) });
     }
 
     connect(
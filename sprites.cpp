@@ -0,0 +1,173 @@
+#include "sprites.h"
+
+#include "chess_namespaces.h"
+#include "paths.h"
+
+#include <QFutureWatcher>
+#include <QGuiApplication>
+#include <QImage>
+#include <QMap>
+#include <QPainter>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+
+namespace {
+    constexpr const size_t spriteCount = 2 * PieceTypeCount;
+
+    // atlas sizes are multiples of bucket, so small resizes reuse atlas
+    constexpr const int bucket = 16;
+    constexpr const int maxCachedAtlases = 4;
+
+    struct Cache;
+    Cache& cache();
+
+    using Images = std::array<QImage, spriteCount>;
+
+    int toBucket(qreal t_pixels) noexcept {
+        const int pixels{ static_cast<int>(std::ceil(t_pixels)) };
+        return std::max(bucket, (pixels + bucket - 1) / bucket * bucket);
+    }
+
+    // all sprites side by side in one row, t_size x t_size each;
+    // uses QImage only, so it can run outside of GUI thread
+    QImage renderAtlas(const Images& t_decoded, int t_size) {
+        QImage atlas(static_cast<int>(spriteCount) * t_size, t_size,
+                     QImage::Format_ARGB32_Premultiplied);
+        atlas.fill(Qt::transparent);
+
+        QPainter painter(&atlas);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        for(size_t i = 0; i < spriteCount; ++i) {
+            painter.drawImage(QRectF(static_cast<int>(i) * t_size, 0, t_size, t_size),
+                              t_decoded[i]);
+        }
+
+        return atlas;
+    }
+
+    // images are decoded once, on first use from any thread
+    const Images& decoded() {
+        static const Images images = [] {
+            const std::array<const QString*, spriteCount> paths{{
+                &Paths::White::pawn, &Paths::White::knight, &Paths::White::bishop,
+                &Paths::White::rook, &Paths::White::queen,  &Paths::White::king,
+                &Paths::Black::pawn, &Paths::Black::knight, &Paths::Black::bishop,
+                &Paths::Black::rook, &Paths::Black::queen,  &Paths::Black::king
+            }};
+
+            Images result;
+            for(size_t i = 0; i < paths.size(); ++i) {
+                result[i] = QImage{ *paths[i] };
+            }
+            return result;
+        }();
+
+        return images;
+    }
+
+    struct Cache
+    {
+        std::array<QPixmap, spriteCount> sprites;
+
+        // bucket -> atlas, QMap keeps them ordered for eviction
+        QMap<int, QImage> atlases;
+        int requested{ 0 };
+
+        Cache() {
+            // first sprites are needed at once, before any view exists
+            requested = toBucket(BoardSizes::FieldWidth * qGuiApp->devicePixelRatio());
+            store(requested, renderAtlas(decoded(), requested));
+            apply(requested);
+
+            // pixmaps must not outlive QGuiApplication, cache itself does
+            qAddPostRoutine([] {
+                cache().sprites.fill(QPixmap{});
+            });
+        }
+
+        void store(int t_bucket, const QImage& t_atlas) {
+            if(atlases.size() >= maxCachedAtlases && !atlases.contains(t_bucket)) {
+                // drop bucket most distant from requested one
+                auto farthest = atlases.begin();
+                if(std::abs(atlases.lastKey() - requested) > std::abs(farthest.key() - requested)) {
+                    farthest = std::prev(atlases.end());
+                }
+                atlases.erase(farthest);
+            }
+            atlases.insert(t_bucket, t_atlas);
+        }
+
+        void apply(int t_bucket) {
+            const QImage& atlas = atlases[t_bucket];
+            const qreal ratio{ t_bucket / BoardSizes::FieldWidth };
+
+            for(size_t i = 0; i < spriteCount; ++i) {
+                sprites[i] = QPixmap::fromImage(atlas.copy(static_cast<int>(i) * t_bucket, 0,
+                                                           t_bucket, t_bucket));
+                sprites[i].setDevicePixelRatio(ratio);
+            }
+        }
+    };
+
+    // QPixmap needs QGuiApplication, so cache is created on first use
+    Cache& cache() {
+        static Cache instance;
+        return instance;
+    }
+}
+
+const QPixmap& Sprites::piece(PieceType t_type, Player t_player) {
+    return cache().sprites[pieceIndex(t_type, t_player)];
+}
+
+void Sprites::setDeviceSize(qreal t_pixels,
+                            QObject* t_context,
+                            std::function<void()> t_ready)
+{
+    Cache& sprites = cache();
+
+    const int size{ toBucket(t_pixels) };
+    if(size == sprites.requested) {
+        return;
+    }
+    sprites.requested = size;
+
+    if(sprites.atlases.contains(size)) {
+        sprites.apply(size);
+        t_ready();
+        return;
+    }
+
+    // owned by t_context, so a render still running at exit is not leaked
+    auto* watcher = new QFutureWatcher<QImage>(t_context);
+    QObject::connect(watcher, &QFutureWatcher<QImage>::finished,
+                     watcher, &QObject::deleteLater);
+    QObject::connect(watcher, &QFutureWatcher<QImage>::finished,
+                     t_context,
+                     [watcher, size, ready = std::move(t_ready)] {
+                         Cache& sprites = cache();
+                         sprites.store(size, watcher->result());
+
+                         // resized again while rendering
+                         if(size == sprites.requested) {
+                             sprites.apply(size);
+                             ready();
+                         }
+                     });
+
+    watcher->setFuture(QtConcurrent::run([size] {
+        return renderAtlas(decoded(), size);
+    }));
+}
+
+QImage Sprites::atlas(int t_size) {
+    return renderAtlas(decoded(), t_size);
+}
+
+QRect Sprites::atlasRect(PieceType t_type, Player t_player, int t_size) noexcept {
+    return { pieceIndex(t_type, t_player) * t_size, 0, t_size, t_size };
+}
@@ -0,0 +1,39 @@
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include <QImage>
+#include <QPixmap>
+#include <QRect>
+
+#include <functional>
+
+class QObject;
+
+enum class PieceType : char;
+enum class Player : char;
+
+// Piece images decoded once and rendered into an atlas for the size
+// at which fields are shown on screen. Returned pixmaps are implicitly
+// shared and have device pixel ratio set, so their logical size is
+// always size of a field.
+namespace Sprites {
+    const QPixmap& piece(PieceType t_type, Player t_player);
+
+    // Requests sprites for fields shown t_pixels device pixels wide.
+    // Sizes are rounded up to buckets and atlases of recent buckets are
+    // kept. A missing atlas is rendered in background; once piece()
+    // returns new sprites, t_ready is called in GUI thread, unless
+    // t_context was destroyed or another size was requested meanwhile.
+    // Pending render is owned by t_context.
+    void setDeviceSize(qreal t_pixels,
+                       QObject* t_context,
+                       std::function<void()> t_ready);
+
+    // All sprites t_size pixels wide side by side in one row, use
+    // atlasRect to find a piece. Uses QImage only, so unlike piece()
+    // it may be called from any thread and without a display.
+    QImage atlas(int t_size);
+    QRect atlasRect(PieceType t_type, Player t_player, int t_size) noexcept;
+}
+
+#endif // SPRITES_H
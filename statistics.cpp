@@ -0,0 +1,102 @@
+#include "statistics.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <array>
+
+namespace {
+    constexpr const size_t counterCount = static_cast<size_t>(Statistics::Counter::Count);
+    constexpr const size_t timerCount   = static_cast<size_t>(Statistics::Timer::Count);
+
+    const std::array<const char*, counterCount> counterNames{{
+        "findValidMoves",
+        "generatedMoves",
+        "haveValidMoves",
+        "canAttackField",
+        "inCheckAfterMove",
+        "checkField",
+        "isGameOver",
+        "movesMade"
+    }};
+
+    const std::array<const char*, timerCount> timerNames{{
+        "findValidMoves",
+        "highlight",
+        "moveExec",
+        "isGameOver"
+    }};
+
+    struct TimerData
+    {
+        quint64 calls{ 0 };
+        qint64  nsecs{ 0 };
+    };
+
+    std::array<quint64, counterCount> counters{};
+    std::array<TimerData, timerCount> timers{};
+
+    std::function<void(const QByteArray&)> listener;
+}
+
+void Statistics::increment(Counter t_counter, quint64 t_value) noexcept {
+    counters[static_cast<size_t>(t_counter)] += t_value;
+}
+
+void Statistics::addTime(Timer t_timer, qint64 t_nsecs) noexcept {
+    auto& timer = timers[static_cast<size_t>(t_timer)];
+
+    ++timer.calls;
+    timer.nsecs += t_nsecs;
+}
+
+void Statistics::reset() noexcept {
+    counters.fill(0);
+    timers.fill({});
+}
+
+QByteArray Statistics::toJson() {
+    QJsonObject countersObject;
+    for(size_t i = 0; i < counterCount; ++i) {
+        countersObject.insert(counterNames[i], static_cast<qint64>(counters[i]));
+    }
+
+    QJsonObject timersObject;
+    for(size_t i = 0; i < timerCount; ++i) {
+        const auto& timer = timers[i];
+
+        QJsonObject timerObject;
+        timerObject.insert("calls",   static_cast<qint64>(timer.calls));
+        timerObject.insert("totalNs", timer.nsecs);
+        timerObject.insert("avgNs",   timer.calls == 0 ?
+                                          0 : static_cast<double>(timer.nsecs) / timer.calls);
+
+        timersObject.insert(timerNames[i], timerObject);
+    }
+
+    QJsonObject root;
+    root.insert("counters", countersObject);
+    root.insert("timers",   timersObject);
+
+    return QJsonDocument(root).toJson();
+}
+
+void Statistics::setListener(std::function<void(const QByteArray&)> t_listener) {
+    listener = std::move(t_listener);
+}
+
+void Statistics::report() {
+    if(listener) {
+        listener(toJson());
+    }
+}
+
+Statistics::ScopedTimer::ScopedTimer(Timer t_timer) noexcept
+    : m_timer(t_timer)
+{
+    m_elapsed.start();
+}
+
+Statistics::ScopedTimer::~ScopedTimer() {
+    addTime(m_timer, m_elapsed.nsecsElapsed());
+}
@@ -0,0 +1,80 @@
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+
+#include <functional>
+
+// Counters and timers of the move generator, enabled with
+// qmake CONFIG+=statistics. When disabled, STATS_* macros expand
+// to nothing and no statistics code is compiled into the game
+// (value passed to STATS_ADD is still evaluated).
+namespace Statistics {
+    enum class Counter : int {
+        FindValidMoves = 0,
+        GeneratedMoves,
+        HaveValidMoves,
+        CanAttackField,
+        InCheckAfterMove,
+        CheckField,
+        IsGameOver,
+        MovesMade,
+        Count
+    };
+
+    enum class Timer : int {
+        FindValidMoves = 0,
+        Highlight,
+        MoveExec,
+        IsGameOver,
+        Count
+    };
+
+    void increment(Counter t_counter, quint64 t_value = 1) noexcept;
+    void addTime(Timer t_timer, qint64 t_nsecs) noexcept;
+    void reset() noexcept;
+
+    // counters and timers (calls, total and average time) as JSON object
+    QByteArray toJson();
+
+    // called with toJson() after every move
+    void setListener(std::function<void(const QByteArray&)> t_listener);
+    void report();
+
+    // adds time spent in its scope to given timer
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Timer t_timer) noexcept;
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Timer m_timer;
+        QElapsedTimer m_elapsed;
+    };
+}
+
+#define STATS_CONCAT_IMPL(a, b) a##b
+#define STATS_CONCAT(a, b) STATS_CONCAT_IMPL(a, b)
+
+#ifdef QTCHESS_STATISTICS
+#   define STATS_COUNT(counter) \
+        Statistics::increment(Statistics::Counter::counter)
+#   define STATS_ADD(counter, value) \
+        Statistics::increment(Statistics::Counter::counter, (value))
+#   define STATS_TIME(timer) \
+        Statistics::ScopedTimer STATS_CONCAT(statsTimer, __LINE__){ Statistics::Timer::timer }
+#   define STATS_REPORT() \
+        Statistics::report()
+#else
+#   define STATS_COUNT(counter)      static_cast<void>(0)
+#   define STATS_ADD(counter, value) static_cast<void>(value)
+#   define STATS_TIME(timer)         static_cast<void>(0)
+#   define STATS_REPORT()            static_cast<void>(0)
+#endif
+
+#endif // STATISTICS_H
@@ -0,0 +1,87 @@
+#include "boardrenderer.h"
+
+#include "../chess_namespaces.h"
+#include "../sprites.h"
+
+#include <QPainter>
+
+namespace {
+    bool toPieceType(QChar t_char, PieceType& t_type) noexcept {
+        switch (t_char.toLower().toLatin1()) {
+            case 'p': t_type = PieceType::Pawn;   return true;
+            case 'n': t_type = PieceType::Knight; return true;
+            case 'b': t_type = PieceType::Bishop; return true;
+            case 'r': t_type = PieceType::Rook;   return true;
+            case 'q': t_type = PieceType::Queen;  return true;
+            case 'k': t_type = PieceType::King;   return true;
+        }
+        return false;
+    }
+}
+
+BoardRenderer::BoardRenderer(int t_fieldSize)
+    : m_fieldSize(t_fieldSize),
+      m_atlas(Sprites::atlas(t_fieldSize)),
+      m_board(BoardSizes::MaxRowCount * t_fieldSize,
+              BoardSizes::MaxColCount * t_fieldSize,
+              QImage::Format_ARGB32_Premultiplied)
+{
+    QPainter painter(&m_board);
+    painter.fillRect(m_board.rect(), BoardBrush::White);
+
+    // top-left field is white, same as Board
+    for(int y = 0; y < BoardSizes::MaxColCount; ++y) {
+        for(int x = 0; x < BoardSizes::MaxRowCount; ++x) {
+            if((x + y) % 2 == 1) {
+                painter.fillRect(x * m_fieldSize, y * m_fieldSize,
+                                 m_fieldSize, m_fieldSize, BoardBrush::Black);
+            }
+        }
+    }
+}
+
+QImage BoardRenderer::render(const QString& t_fen) const {
+    const QString placement{ t_fen.section(' ', 0, 0, QString::SectionSkipEmpty) };
+
+    QImage image{ m_board.copy() };
+    QPainter painter(&image);
+
+    // black starts at the top
+    int row  = 0;
+    int file = 0;
+    for(const QChar c : placement) {
+        if(c == '/') {
+            if(file != BoardSizes::MaxRowCount) {
+                return {};
+            }
+            ++row;
+            file = 0;
+            continue;
+        }
+        if(c >= '1' && c <= '8') {
+            file += c.toLatin1() - '0';
+            continue;
+        }
+
+        PieceType type;
+        if(!toPieceType(c, type) ||
+           row  >= BoardSizes::MaxColCount ||
+           file >= BoardSizes::MaxRowCount)
+        {
+            return {};
+        }
+
+        const Player player{ c.isUpper() ? Player::White : Player::Black };
+
+        // sprites already have field size, so no scaling is done here
+        painter.drawImage(QPoint(file * m_fieldSize, row * m_fieldSize),
+                          m_atlas, Sprites::atlasRect(type, player, m_fieldSize));
+        ++file;
+    }
+
+    if(row != BoardSizes::MaxColCount - 1 || file != BoardSizes::MaxRowCount) {
+        return {};
+    }
+
+    return image;
+}
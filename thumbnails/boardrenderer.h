@@ -0,0 +1,26 @@
+#ifndef BOARDRENDERER_H
+#define BOARDRENDERER_H
+
+#include <QImage>
+#include <QString>
+
+// Draws positions the way MainWindow shows them, but into QImage, so it
+// needs no display and one renderer may be used by many threads at once.
+class BoardRenderer
+{
+public:
+    // t_fieldSize - pixels per field, board is 8 times wider
+    explicit BoardRenderer(int t_fieldSize);
+
+    // board with pieces of FEN placement, other FEN fields are ignored;
+    // null image if placement is not valid
+    QImage render(const QString& t_fen) const;
+
+private:
+    const int m_fieldSize;
+
+    QImage m_atlas; // sprites of m_fieldSize
+    QImage m_board; // empty board, copied for each position
+};
+
+#endif // BOARDRENDERER_H
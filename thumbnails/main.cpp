@@ -0,0 +1,201 @@
+#include "boardrenderer.h"
+
+#include "../chess_namespaces.h"
+
+#include <QAtomicInt>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QGuiApplication>
+#include <QSet>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+    enum ExitCode : int {
+        Success  = 0,
+        Failed   = 1,
+        BadInput = 2
+    };
+
+    struct Position
+    {
+        QString fen;
+        QString name; // of image, without suffix
+    };
+
+    // image is written into output directory only
+    bool isValidName(const QString& t_name) {
+        return !t_name.contains('/') && !t_name.contains('\\') &&
+               t_name != "." && t_name != "..";
+    }
+
+    // One FEN per line, optionally followed by a tab and name of the image.
+    // PGN tags are skipped, except FEN tag, and so is movetext of .pgn files.
+    // Games starting from the initial position have no FEN tag, they are
+    // reported and skipped.
+    bool readPositions(const QString& t_fileName, std::vector<Position>& t_positions) {
+        QFile file(t_fileName);
+        const bool opened = t_fileName == "-" ? file.open(stdin, QIODevice::ReadOnly) :
+                                                file.open(QIODevice::ReadOnly);
+        if(!opened) {
+            QTextStream(stderr) << "cannot read " << t_fileName << '\n';
+            return false;
+        }
+
+        const bool pgn{ t_fileName.endsWith(".pgn", Qt::CaseInsensitive) };
+        const QString fenTag{ "[FEN \"" };
+
+        // each game of .pgn file starts with a block of tags
+        int games{ 0 };
+        int gamesWithFen{ 0 };
+        bool inTags{ false };
+
+        QTextStream in(&file);
+        QString line;
+        while(in.readLineInto(&line)) {
+            line = line.trimmed();
+
+            const bool tag{ line.startsWith('[') };
+            if(tag && !inTags) {
+                ++games;
+            }
+            inTags = tag;
+
+            if(line.startsWith(fenTag)) {
+                ++gamesWithFen;
+                const int end = line.indexOf('"', fenTag.size());
+                t_positions.push_back({ line.mid(fenTag.size(), end - fenTag.size()), {} });
+                continue;
+            }
+            if(pgn || line.isEmpty() || line.startsWith('[') || line.startsWith('#')) {
+                continue;
+            }
+
+            const QString name{ line.section('\t', 1).trimmed() };
+            if(!isValidName(name)) {
+                QTextStream(stderr) << "invalid image name " << name << " in " << t_fileName << '\n';
+                return false;
+            }
+
+            t_positions.push_back({ line.section('\t', 0, 0).trimmed(), name });
+        }
+
+        if(pgn && gamesWithFen < games) {
+            QTextStream(stderr) << games - gamesWithFen << " of " << games << " games in "
+                                << t_fileName << " have no FEN tag, skipped\n";
+        }
+
+        return true;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // images are only saved, never shown
+    if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName("qtchess_thumbnails");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Renders board images of positions to PNG files.\n"
+                                     "Images are named by the position number, unless\n"
+                                     "a name follows the FEN after a tab.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("files", "Files with FENs or PGN with FEN tags, - for stdin.",
+                                 "[files...]");
+
+    const QCommandLineOption outputOption{ "output-dir", "Write images to <dir>.", "dir", "." };
+    const QCommandLineOption sizeOption{ "size", "Width of the board in pixels, rounded down "
+                                                 "to whole fields.", "pixels",
+                                         QString::number(static_cast<int>(BoardSizes::BoardWidth)) };
+    const QCommandLineOption jobsOption{ "jobs", "Number of worker threads.", "count",
+                                         QString::number(std::max(1, QThread::idealThreadCount())) };
+    parser.addOption(outputOption);
+    parser.addOption(sizeOption);
+    parser.addOption(jobsOption);
+    parser.process(app);
+
+    const int fieldSize{ parser.value(sizeOption).toInt() / BoardSizes::MaxRowCount };
+    if(fieldSize < 1) {
+        QTextStream(stderr) << "invalid board size\n";
+        return BadInput;
+    }
+
+    const int jobs{ parser.value(jobsOption).toInt() };
+    if(jobs < 1) {
+        QTextStream(stderr) << "invalid number of jobs\n";
+        return BadInput;
+    }
+
+    const QDir dir{ parser.value(outputOption) };
+    if(!dir.mkpath(".")) {
+        QTextStream(stderr) << "cannot create " << dir.path() << '\n';
+        return BadInput;
+    }
+
+    QStringList files{ parser.positionalArguments() };
+    if(files.isEmpty()) {
+        files << "-";
+    }
+
+    std::vector<Position> positions;
+    for(const QString& fileName : files) {
+        if(!readPositions(fileName, positions)) {
+            return BadInput;
+        }
+    }
+
+    // images with the same name would overwrite each other
+    QSet<QString> names;
+    bool duplicates = false;
+    for(size_t i = 0; i < positions.size(); ++i) {
+        if(positions[i].name.isEmpty()) {
+            positions[i].name = QString("%1").arg(i + 1, 6, 10, QChar('0'));
+        }
+        if(names.contains(positions[i].name)) {
+            QTextStream(stderr) << "duplicate image name " << positions[i].name << '\n';
+            duplicates = true;
+        }
+        names.insert(positions[i].name);
+    }
+    if(duplicates) {
+        return BadInput;
+    }
+
+    // board and sprites are shared by workers, each one paints only
+    // its own image
+    const BoardRenderer renderer{ fieldSize };
+
+    QAtomicInt failed{ 0 };
+    QThreadPool::globalInstance()->setMaxThreadCount(jobs);
+    QtConcurrent::blockingMap(positions, [&](const Position& t_position) {
+        const QImage image{ renderer.render(t_position.fen) };
+        if(image.isNull()) {
+            failed.fetchAndAddRelaxed(1);
+            qWarning().noquote() << "invalid position" << t_position.fen;
+            return;
+        }
+
+        const QString fileName{ dir.filePath(t_position.name + ".png") };
+        if(!image.save(fileName, "PNG")) {
+            failed.fetchAndAddRelaxed(1);
+            qWarning().noquote() << "cannot write" << fileName;
+        }
+    });
+
+    const int failures{ failed.load() };
+    QTextStream(stdout) << positions.size() - static_cast<size_t>(failures) << " rendered, "
+                        << failures << " failed\n";
+
+    return failures == 0 ? Success : Failed;
+}
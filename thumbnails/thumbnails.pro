@@ -0,0 +1,38 @@
+#-------------------------------------------------
+#
+# Renders board images of FEN positions to PNG,
+# headless and in parallel
+#
+# qtchess_thumbnails [--output-dir dir] [--size 384] [--jobs N] [files...]
+#
+#-------------------------------------------------
+
+QT       += core gui concurrent
+
+CONFIG += c++14 console
+CONFIG -= app_bundle
+
+TARGET = qtchess_thumbnails
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+QMAKE_CXXFLAGS += -Wall
+QMAKE_CXXFLAGS += -Wextra
+
+INCLUDEPATH += ..
+
+SOURCES += \
+    main.cpp \
+    boardrenderer.cpp \
+    ../paths.cpp \
+    ../sprites.cpp
+
+HEADERS += \
+    boardrenderer.h \
+    ../paths.h \
+    ../sprites.h \
+    ../chess_namespaces.h
+
+RESOURCES += \
+    ../resources.qrc
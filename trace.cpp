@@ -0,0 +1,113 @@
+#include "trace.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+    constexpr const size_t bufferSize = 1 << 14; // events per thread
+
+    struct Event
+    {
+        const char* name{ nullptr };
+        Trace::Clock::time_point begin;
+        Trace::Clock::time_point end;
+    };
+
+    // written only by its thread, read by write() once recording is over
+    struct Buffer
+    {
+        explicit Buffer(int t_threadId) noexcept
+            : threadId(t_threadId)
+        {
+        }
+
+        const int threadId;
+        std::atomic<size_t> recorded{ 0 };
+        std::array<Event, bufferSize> events;
+    };
+
+    const Trace::Clock::time_point startTime{ Trace::Clock::now() };
+
+    // buffers are registered once per thread, never on the hot path
+    std::mutex buffersMutex;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+
+    Buffer* createBuffer() {
+        std::lock_guard<std::mutex> lock{ buffersMutex };
+
+        buffers.push_back(std::make_unique<Buffer>(static_cast<int>(buffers.size()) + 1));
+        return buffers.back().get();
+    }
+
+    Buffer& threadBuffer() {
+        thread_local Buffer* buffer{ createBuffer() };
+        return *buffer;
+    }
+
+    double toMicroseconds(Trace::Clock::duration t_duration) noexcept {
+        return std::chrono::duration<double, std::micro>(t_duration).count();
+    }
+}
+
+void Trace::record(const char* t_name,
+                   Clock::time_point t_begin,
+                   Clock::time_point t_end) noexcept
+{
+    Buffer& buffer = threadBuffer();
+
+    // oldest events get overwritten when buffer is full
+    const size_t index{ buffer.recorded.load(std::memory_order_relaxed) };
+    buffer.events[index % bufferSize] = { t_name, t_begin, t_end };
+    buffer.recorded.store(index + 1, std::memory_order_release);
+}
+
+bool Trace::write(const QString& t_path) {
+    QJsonArray events;
+
+    std::lock_guard<std::mutex> lock{ buffersMutex };
+    for(const auto& buffer : buffers) {
+        const size_t recorded{ buffer->recorded.load(std::memory_order_acquire) };
+        const size_t first{ recorded > bufferSize ? recorded - bufferSize : 0 };
+
+        for(size_t i = first; i < recorded; ++i) {
+            const Event& event = buffer->events[i % bufferSize];
+
+            QJsonObject object;
+            object.insert("name", event.name);
+            object.insert("cat",  "qtchess");
+            object.insert("ph",   "X"); // complete event, begin + duration
+            object.insert("ts",   toMicroseconds(event.begin - startTime));
+            object.insert("dur",  toMicroseconds(event.end - event.begin));
+            object.insert("pid",  1);
+            object.insert("tid",  buffer->threadId);
+
+            events.append(object);
+        }
+    }
+
+    QJsonObject root;
+    root.insert("traceEvents", events);
+    root.insert("displayTimeUnit", "ns");
+
+    QFile file{ t_path };
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    return file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) != -1;
+}
+
+bool Trace::writeOnExit() {
+    const QByteArray path{ qgetenv("QTCHESS_TRACE_FILE") };
+
+    return write(path.isEmpty() ? QString{ "qtchess_trace.json" } :
+                                  QString::fromLocal8Bit(path));
+}
@@ -0,0 +1,56 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <QString>
+
+#include <chrono>
+
+// Timeline of game events in Chrome Trace Event format, enabled with
+// qmake CONFIG+=tracing. Events are kept in fixed size per-thread ring
+// buffers, recording does not allocate nor lock. Trace is written on exit
+// to file given by QTCHESS_TRACE_FILE, qtchess_trace.json by default.
+// When disabled, TRACE_SCOPE expands to nothing.
+namespace Trace {
+    using Clock = std::chrono::steady_clock;
+
+    // t_name must be a string literal, only the pointer is stored
+    void record(const char* t_name,
+                Clock::time_point t_begin,
+                Clock::time_point t_end) noexcept;
+
+    bool write(const QString& t_path);
+    bool writeOnExit();
+
+    // records duration of its scope as one complete event
+    class Scope
+    {
+    public:
+        explicit Scope(const char* t_name) noexcept
+            : m_name(t_name), m_begin(Clock::now())
+        {
+        }
+
+        ~Scope() {
+            record(m_name, m_begin, Clock::now());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* m_name;
+        Clock::time_point m_begin;
+    };
+}
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifdef QTCHESS_TRACING
+#   define TRACE_SCOPE(name) \
+        Trace::Scope TRACE_CONCAT(traceScope, __LINE__){ name }
+#else
+#   define TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif // TRACE_H